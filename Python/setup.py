@@ -0,0 +1,40 @@
+#
+#  setup.py
+#  VXAtomExtension
+#
+#  Builds the `vxatom` Python extension around VXAtomExtensionDSPKernel.
+#  The AudioToolbox types come from ../Shim on every platform: the kernel only needs the
+#  plain C render types, and the SDK's AUParameters.h is Objective-C only.
+#
+#    python3 setup.py build_ext --inplace
+#
+
+from pathlib import Path
+
+from setuptools import Extension, setup
+
+here = Path(__file__).resolve().parent
+extension_root = here.parent / "VX-AtomExtension"
+
+include_dirs = [
+    str(here.parent / "Shim"),
+    str(extension_root / "DSP"),
+    str(extension_root / "Parameters"),
+]
+
+setup(
+    name="vxatom",
+    version="1.0.0",
+    description="VX-ATOM character compressor DSP kernel for offline analysis",
+    ext_modules=[
+        Extension(
+            "vxatom",
+            sources=["vxatom_module.cpp"],
+            include_dirs=include_dirs,
+            # The kernel is header-only; list it so header edits trigger a rebuild.
+            depends=[str(path) for path in (extension_root / "DSP").glob("*.hpp")],
+            language="c++",
+            extra_compile_args=["-std=c++20", "-O3", "-Wall"],
+        )
+    ],
+)
@@ -0,0 +1,228 @@
+#
+#  test_vxatom.py
+#  VXAtomExtension
+#
+#  Tests for the vxatom Python bindings. Build the module in place first:
+#
+#    python3 setup.py build_ext --inplace && python3 -m pytest test_vxatom.py
+#
+
+import struct
+import threading
+
+import numpy as np
+import pytest
+
+import vxatom
+
+SAMPLE_RATE = 48000.0
+
+
+def stereo_signal(frames=SAMPLE_RATE):
+    """(frames, 2) interleaved float32: loud and quiet sections so every stage moves."""
+    t = np.arange(int(frames)) / SAMPLE_RATE
+    level = np.where((np.arange(int(frames)) // 4096) % 3 == 0, 0.9, 0.05)
+    left = level * np.sin(2 * np.pi * 220 * t)
+    right = level * np.sin(2 * np.pi * 330 * t)
+    return np.stack([left, right], axis=1).astype(np.float32)
+
+
+def make_kernel(**kwargs):
+    kernel = vxatom.Kernel(sample_rate=SAMPLE_RATE, channels=2, max_frames=512, **kwargs)
+    kernel.set_parameter(vxatom.COMPRESS, 8.0)
+    kernel.set_parameter(vxatom.SPEED, 7.0)
+    return kernel
+
+
+def test_interleaved_matches_planar():
+    interleaved = stereo_signal()
+    planar = np.ascontiguousarray(interleaved.T)
+
+    make_kernel().process(interleaved.T)
+    make_kernel().process(planar)
+
+    assert np.array_equal(interleaved.T, planar)
+
+
+def test_processes_in_place():
+    audio = stereo_signal().T
+    original = audio.copy()
+    address = audio.__array_interface__["data"][0]
+
+    assert make_kernel().process(audio) is None
+    assert audio.__array_interface__["data"][0] == address
+    assert not np.array_equal(audio, original)
+
+
+def test_mono_and_memoryview():
+    mono = stereo_signal()[:, 0].copy()
+    view = memoryview(mono)
+    kernel = vxatom.Kernel(sample_rate=SAMPLE_RATE, channels=1)
+    kernel.set_parameter(vxatom.COMPRESS, 8.0)
+    original = mono.copy()
+
+    kernel.process(view)
+
+    assert not np.array_equal(mono, original)
+
+
+def test_trace_shape_and_values():
+    audio = stereo_signal().T
+    untraced = audio.copy()
+    trace = np.full_like(audio, -1.0)
+
+    make_kernel(trace=True).process(audio, trace=trace)
+    make_kernel().process(untraced)
+
+    assert trace.shape == audio.shape
+    assert np.array_equal(audio, untraced)  # tracing does not change the audio
+    assert np.all(trace >= 0.0)             # positive dB of reduction on every sample
+    assert trace.max() > 10.0               # COMPRESS 8 on the loud sections
+    # Quiet sections reduce less than loud ones.
+    assert trace[0, 4096 + 2048] < trace[0, 2048]
+
+
+def test_trace_requires_trace_kernel():
+    audio = stereo_signal().T
+    with pytest.raises(ValueError):
+        make_kernel().process(audio, trace=np.zeros_like(audio))
+
+
+def test_trace_must_not_overlap_audio():
+    audio = stereo_signal().T
+    kernel = make_kernel(trace=True)
+    with pytest.raises(ValueError):
+        kernel.process(audio, trace=audio)
+    storage = np.zeros((4, audio.shape[1]), dtype=np.float32)
+    with pytest.raises(ValueError):
+        kernel.process(storage[0:2], trace=storage[1:3])
+
+
+def test_rejects_read_only_buffer():
+    audio = stereo_signal().T
+    audio.flags.writeable = False
+    # NumPy refuses a writable export with ValueError; other exporters use BufferError.
+    with pytest.raises((BufferError, ValueError)):
+        make_kernel().process(audio)
+
+
+def test_rejects_wrong_dtype():
+    with pytest.raises(TypeError):
+        make_kernel().process(stereo_signal().T.astype(np.float64))
+
+
+def test_rejects_wrong_channel_count():
+    with pytest.raises(ValueError):
+        make_kernel().process(np.zeros((3, 512), dtype=np.float32))
+    with pytest.raises(ValueError):
+        make_kernel().process(np.zeros(512, dtype=np.float32))
+
+
+def test_rejects_reentrant_use():
+    kernel = make_kernel()
+    audio = np.tile(stereo_signal().T, (1, 20))
+    errors = []
+
+    worker = threading.Thread(target=kernel.process, args=(audio,))
+    worker.start()
+    while worker.is_alive():
+        try:
+            kernel.get_parameter(vxatom.COMPRESS)
+        except RuntimeError as error:
+            errors.append(error)
+            break
+    worker.join()
+
+    assert errors, "calls made while the kernel renders must raise"
+    assert kernel.get_parameter(vxatom.COMPRESS) == 8.0  # usable again afterwards
+
+
+def test_separate_kernels_render_in_parallel_threads():
+    signal = stereo_signal().T
+    buffers = [signal.copy() for _ in range(4)]
+    kernels = [make_kernel() for _ in buffers]
+    threads = [threading.Thread(target=k.process, args=(b,)) for k, b in zip(kernels, buffers)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    expected = signal.copy()
+    make_kernel().process(expected)
+    for buffer in buffers:
+        assert np.array_equal(buffer, expected)
+
+
+def test_fork_continues_bit_exact():
+    signal = stereo_signal().T
+    intro, verse = signal[:, :12000].copy(), signal[:, 12000:].copy()
+    kernel = make_kernel(trace=True)
+    kernel.process(intro)
+
+    fork = kernel.fork()
+    assert fork.get_parameter(vxatom.COMPRESS) == 8.0
+    original_verse, forked_verse = verse.copy(), verse.copy()
+    original_trace, forked_trace = np.empty_like(verse), np.empty_like(verse)
+    kernel.process(original_verse, trace=original_trace)
+    fork.process(forked_verse, trace=forked_trace)
+
+    assert np.array_equal(original_verse, forked_verse)
+    assert np.array_equal(original_trace, forked_trace)
+    assert kernel.gain_reduction_db == fork.gain_reduction_db
+
+
+def test_snapshot_then_restore_continues_bit_exact():
+    signal = stereo_signal().T
+    intro, verse = signal[:, :12000].copy(), signal[:, 12000:].copy()
+    kernel = make_kernel()
+    kernel.process(intro)
+    snapshot = kernel.snapshot()
+
+    restored = vxatom.Kernel(sample_rate=SAMPLE_RATE, channels=2, max_frames=512)
+    restored.restore(snapshot)
+    assert restored.get_parameter(vxatom.COMPRESS) == 8.0
+    assert restored.snapshot() == snapshot
+
+    original_verse, restored_verse = verse.copy(), verse.copy()
+    kernel.process(original_verse)
+    restored.process(restored_verse)
+    assert np.array_equal(original_verse, restored_verse)
+
+
+def test_restore_rejects_other_sample_rate():
+    kernel = make_kernel()
+    kernel.process(stereo_signal().T)
+    with pytest.raises(ValueError, match="Hz"):
+        vxatom.Kernel(sample_rate=44100.0, channels=2).restore(kernel.snapshot())
+
+
+def test_restore_rejects_other_channel_count():
+    mono = vxatom.Kernel(sample_rate=SAMPLE_RATE, channels=1)
+    mono.process(stereo_signal()[:, 0].copy())
+    with pytest.raises(ValueError, match="channel"):
+        make_kernel().restore(mono.snapshot())
+
+
+# Byte offsets into VXAtomKernelSnapshot (see VX-AtomExtensionDSPKernel.hpp).
+SNAPSHOT_COMPRESS_OFFSET = 24
+SNAPSHOT_ENVELOPE_OFFSET = 64
+
+
+def test_restore_clamps_parameters_and_rejects_corrupt_state():
+    kernel = make_kernel()
+    kernel.process(stereo_signal().T)
+    snapshot = bytearray(kernel.snapshot())
+
+    oversized = bytearray(snapshot)
+    struct.pack_into("f", oversized, SNAPSHOT_COMPRESS_OFFSET, 1e9)
+    restored = make_kernel()
+    restored.restore(bytes(oversized))
+    assert restored.get_parameter(vxatom.COMPRESS) == 10.0
+
+    corrupt = bytearray(snapshot)
+    struct.pack_into("f", corrupt, SNAPSHOT_ENVELOPE_OFFSET, float("nan"))
+    with pytest.raises(ValueError, match="corrupt"):
+        restored.restore(bytes(corrupt))
+    audio = stereo_signal().T
+    restored.process(audio)
+    assert np.all(np.isfinite(audio))
@@ -0,0 +1,490 @@
+//
+//  vxatom_module.cpp
+//  VXAtomExtension
+//
+//  Python bindings for VXAtomExtensionDSPKernel, for offline analysis and batch processing.
+//
+//  Audio is processed in place through the buffer protocol: any writable float32 buffer
+//  (NumPy arrays, memoryviews) is wrapped in strided channel views, so neither C-ordered
+//  (channels, frames) arrays nor transposed interleaved (frames, channels).T arrays are copied.
+//  The optional gain-reduction trace is the exception: the kernel records it into its render
+//  arena, and each block is copied out to the caller's trace buffer.
+//  The GIL is released while the kernel renders, so separate kernels run in parallel threads.
+//
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "VX-AtomExtensionDSPKernel.hpp"
+
+namespace {
+
+// MARK: - Kernel State
+
+struct KernelState {
+    VXAtomExtensionDSPKernel kernel;
+    std::vector<VXAtomChannelView<float>>       audioViews;   // whole-buffer channel views
+    std::vector<VXAtomChannelView<float>>       traceViews;
+    std::vector<VXAtomChannelView<float const>> inputViews;   // per-block views handed to the kernel
+    std::vector<VXAtomChannelView<float>>       outputViews;
+    double            sampleRate   = 44100.0;
+    int               channelCount = 2;
+    AUAudioFrameCount maxFrames    = 1024;
+    AUEventSampleTime sampleTime   = 0;
+};
+
+struct KernelObject {
+    PyObject_HEAD
+    KernelState* state;
+    bool         busy;  // read and written with the GIL held; true while a render has released it
+};
+
+// MARK: - Buffer Helpers
+
+bool isNativeFloat32(Py_buffer const& buffer) {
+    if (buffer.itemsize != sizeof(float) || buffer.format == nullptr) {
+        return false;
+    }
+    const char* format = buffer.format;
+    if (format[0] == '@' || format[0] == '=' || format[0] == '<') {
+        ++format;
+    }
+    return std::strcmp(format, "f") == 0;
+}
+
+// Maps a (frames,) mono or (channels, frames) buffer onto one strided view per channel.
+// Returns the frame count, or -1 with a Python exception set.
+Py_ssize_t mapChannelViews(Py_buffer const& buffer, int channelCount, char const* name,
+                           std::vector<VXAtomChannelView<float>>& views) {
+    if (!isNativeFloat32(buffer)) {
+        PyErr_Format(PyExc_TypeError, "%s must be a native float32 buffer", name);
+        return -1;
+    }
+
+    Py_ssize_t channels, frames, channelStride, frameStride;
+    if (buffer.ndim == 1) {
+        channels      = 1;
+        frames        = buffer.shape[0];
+        channelStride = 0;
+        frameStride   = buffer.strides[0];
+    } else if (buffer.ndim == 2) {
+        channels      = buffer.shape[0];
+        frames        = buffer.shape[1];
+        channelStride = buffer.strides[0];
+        frameStride   = buffer.strides[1];
+    } else {
+        PyErr_Format(PyExc_ValueError, "%s must have shape (frames,) or (channels, frames)", name);
+        return -1;
+    }
+
+    if (channels != channelCount) {
+        PyErr_Format(PyExc_ValueError, "%s has %zd channels, kernel was created with %d",
+                     name, channels, channelCount);
+        return -1;
+    }
+    if (frames > 0 && (frameStride <= 0 || frameStride % Py_ssize_t(sizeof(float)) != 0
+                       || channelStride % Py_ssize_t(sizeof(float)) != 0)) {
+        PyErr_Format(PyExc_ValueError, "%s must have positive, float-aligned strides", name);
+        return -1;
+    }
+
+    char* base = static_cast<char*>(buffer.buf);
+    for (int ch = 0; ch < channelCount; ++ch) {
+        views[ch] = { reinterpret_cast<float*>(base + ch * channelStride),
+                      static_cast<UInt32>(frameStride / Py_ssize_t(sizeof(float))) };
+    }
+    return frames;
+}
+
+// Byte range [begin, end) touched by a strided buffer, for any stride signs.
+void bufferExtent(Py_buffer const& buffer, char const*& begin, char const*& end) {
+    begin = end = static_cast<char const*>(buffer.buf);
+    for (int dim = 0; dim < buffer.ndim; ++dim) {
+        if (buffer.shape[dim] == 0) {
+            end = begin;
+            return;
+        }
+        const Py_ssize_t reach = (buffer.shape[dim] - 1) * buffer.strides[dim];
+        if (reach < 0) {
+            begin += reach;
+        } else {
+            end += reach;
+        }
+    }
+    end += buffer.itemsize;
+}
+
+bool buffersOverlap(Py_buffer const& a, Py_buffer const& b) {
+    char const *aBegin, *aEnd, *bBegin, *bEnd;
+    bufferExtent(a, aBegin, aEnd);
+    bufferExtent(b, bBegin, bEnd);
+    return aBegin < bEnd && bBegin < aEnd;
+}
+
+// MARK: - Kernel Type
+
+void Kernel_dealloc(KernelObject* self) {
+    delete self->state;
+    Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+int Kernel_init(KernelObject* self, PyObject* args, PyObject* kwargs) {
+    static char const* keywords[] = { "sample_rate", "channels", "max_frames", "trace", nullptr };
+    double sampleRate   = 44100.0;
+    int    channelCount = 2;
+    int    maxFrames    = 1024;
+    int    trace        = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|diip", const_cast<char**>(keywords),
+                                     &sampleRate, &channelCount, &maxFrames, &trace)) {
+        return -1;
+    }
+    if (self->busy) {
+        PyErr_SetString(PyExc_RuntimeError, "kernel is rendering in another thread");
+        return -1;
+    }
+    if (sampleRate <= 0.0) {
+        PyErr_SetString(PyExc_ValueError, "sample_rate must be positive");
+        return -1;
+    }
+    if (channelCount < 1 || channelCount > 2) {
+        PyErr_SetString(PyExc_ValueError, "channels must be 1 or 2");
+        return -1;
+    }
+    if (maxFrames < 1) {
+        PyErr_SetString(PyExc_ValueError, "max_frames must be positive");
+        return -1;
+    }
+
+    auto* state = new (std::nothrow) KernelState();
+    if (state == nullptr) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    state->sampleRate   = sampleRate;
+    state->channelCount = channelCount;
+    state->maxFrames    = static_cast<AUAudioFrameCount>(maxFrames);
+    state->audioViews.resize(channelCount);
+    state->traceViews.resize(channelCount);
+    state->inputViews.resize(channelCount);
+    state->outputViews.resize(channelCount);
+
+    state->kernel.setMaximumFramesToRender(state->maxFrames);
+    state->kernel.setRenderFeatures({ .gainReductionTrace = trace != 0 });
+    state->kernel.initialize(channelCount, channelCount, sampleRate);
+
+    delete self->state;
+    self->state = state;
+    return 0;
+}
+
+bool checkReady(KernelObject* self) {
+    if (self->state == nullptr) {
+        PyErr_SetString(PyExc_RuntimeError, "kernel is not initialized");
+        return false;
+    }
+    if (self->busy) {
+        PyErr_SetString(PyExc_RuntimeError, "kernel is rendering in another thread");
+        return false;
+    }
+    return true;
+}
+
+PyObject* Kernel_process(KernelObject* self, PyObject* args, PyObject* kwargs) {
+    static char const* keywords[] = { "audio", "trace", nullptr };
+    PyObject* audioObject = nullptr;
+    PyObject* traceObject = Py_None;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O", const_cast<char**>(keywords),
+                                     &audioObject, &traceObject)) {
+        return nullptr;
+    }
+    if (!checkReady(self)) {
+        return nullptr;
+    }
+    KernelState& state = *self->state;
+    const bool wantsTrace = traceObject != Py_None;
+    if (wantsTrace && !state.kernel.renderFeatures().gainReductionTrace) {
+        PyErr_SetString(PyExc_ValueError, "create the kernel with trace=True to record gain reduction");
+        return nullptr;
+    }
+
+    const int flags = PyBUF_WRITABLE | PyBUF_FORMAT | PyBUF_STRIDES;
+    Py_buffer audio {};
+    Py_buffer trace {};
+    if (PyObject_GetBuffer(audioObject, &audio, flags) != 0) {
+        return nullptr;
+    }
+    if (wantsTrace && PyObject_GetBuffer(traceObject, &trace, flags) != 0) {
+        PyBuffer_Release(&audio);
+        return nullptr;
+    }
+    auto releaseBuffers = [&] {
+        if (wantsTrace) {
+            PyBuffer_Release(&trace);
+        }
+        PyBuffer_Release(&audio);
+    };
+
+    const Py_ssize_t frames = mapChannelViews(audio, state.channelCount, "audio", state.audioViews);
+    if (frames < 0) {
+        releaseBuffers();
+        return nullptr;
+    }
+    if (wantsTrace) {
+        const Py_ssize_t traceFrames = mapChannelViews(trace, state.channelCount, "trace", state.traceViews);
+        if (traceFrames < 0) {
+            releaseBuffers();
+            return nullptr;
+        }
+        if (traceFrames != frames) {
+            PyErr_SetString(PyExc_ValueError, "trace must have the same shape as audio");
+            releaseBuffers();
+            return nullptr;
+        }
+        // Conservative: interleaved siblings in one allocation also count as overlapping.
+        if (buffersOverlap(audio, trace)) {
+            PyErr_SetString(PyExc_ValueError, "trace must not overlap audio");
+            releaseBuffers();
+            return nullptr;
+        }
+    }
+
+    self->busy = true;
+    Py_BEGIN_ALLOW_THREADS
+
+    // Render in place, max_frames at a time, exactly as the host drives the render block.
+    for (Py_ssize_t offset = 0; offset < frames; offset += state.maxFrames) {
+        const auto blockFrames = static_cast<AUAudioFrameCount>(
+            std::min<Py_ssize_t>(state.maxFrames, frames - offset));
+
+        for (int ch = 0; ch < state.channelCount; ++ch) {
+            VXAtomChannelView<float> const& channel = state.audioViews[ch];
+            float* blockStart = channel.data + static_cast<size_t>(offset) * channel.stride;
+            state.inputViews[ch]  = { blockStart, channel.stride };
+            state.outputViews[ch] = { blockStart, channel.stride };
+        }
+
+        state.kernel.process(state.inputViews, state.outputViews, state.sampleTime, blockFrames);
+        state.sampleTime += blockFrames;
+
+        // Copy this block's trace out of the kernel's arena into the caller's buffer.
+        if (wantsTrace) {
+            for (int ch = 0; ch < state.channelCount; ++ch) {
+                std::span<float const> reduction = state.kernel.gainReductionTrace(ch);
+                VXAtomChannelView<float> const& channel = state.traceViews[ch];
+                VXAtomChannelView<float> block { channel.data + static_cast<size_t>(offset) * channel.stride,
+                                                 channel.stride };
+                for (UInt32 i = 0; i < reduction.size(); ++i) {
+                    block[i] = reduction[i];
+                }
+            }
+        }
+    }
+
+    Py_END_ALLOW_THREADS
+    self->busy = false;
+
+    releaseBuffers();
+    Py_RETURN_NONE;
+}
+
+PyObject* Kernel_reset(KernelObject* self, PyObject*) {
+    if (!checkReady(self)) {
+        return nullptr;
+    }
+    KernelState& state = *self->state;
+    state.kernel.initialize(state.channelCount, state.channelCount, state.sampleRate);
+    state.sampleTime = 0;
+    Py_RETURN_NONE;
+}
+
+PyObject* Kernel_snapshot(KernelObject* self, PyObject*) {
+    if (!checkReady(self)) {
+        return nullptr;
+    }
+    VXAtomKernelSnapshot snapshot;
+    self->state->kernel.saveSnapshot(snapshot);
+    return PyBytes_FromStringAndSize(reinterpret_cast<char const*>(&snapshot), sizeof(snapshot));
+}
+
+PyObject* Kernel_restore(KernelObject* self, PyObject* args) {
+    Py_buffer snapshot {};
+    if (!PyArg_ParseTuple(args, "y*", &snapshot)) {
+        return nullptr;
+    }
+    if (!checkReady(self)) {
+        PyBuffer_Release(&snapshot);
+        return nullptr;
+    }
+    // No host parameter tree here, so the snapshot's parameters are applied along with the state.
+    VXAtomKernelSnapshot decoded;
+    VXAtomExtensionDSPKernel& kernel = self->state->kernel;
+    const bool decodedOK = PyBuffer_IsContiguous(&snapshot, 'C')
+                        && VXAtomExtensionDSPKernel::decodeSnapshot(snapshot.buf, static_cast<size_t>(snapshot.len), decoded);
+    PyBuffer_Release(&snapshot);
+    if (!decodedOK) {
+        PyErr_SetString(PyExc_ValueError, "snapshot is corrupt or from another layout version");
+        return nullptr;
+    }
+    // Decoded snapshots are valid, so only the kernel's format can still reject one.
+    if (!kernel.restoreSnapshot(decoded) || !kernel.applySnapshotParameters(decoded)) {
+        PyErr_Format(PyExc_ValueError, "snapshot was taken at %g Hz with %u channel(s), kernel runs at %g Hz with %d",
+                     decoded.sampleRate, static_cast<unsigned>(decoded.channelCount),
+                     self->state->sampleRate, self->state->channelCount);
+        return nullptr;
+    }
+    Py_RETURN_NONE;
+}
+
+PyObject* Kernel_fork(KernelObject* self, PyObject*) {
+    if (!checkReady(self)) {
+        return nullptr;
+    }
+    KernelState const& state = *self->state;
+    PyObject* fork = PyObject_CallFunction(reinterpret_cast<PyObject*>(Py_TYPE(self)), "dIIO",
+                                           state.sampleRate,
+                                           static_cast<unsigned int>(state.channelCount),
+                                           static_cast<unsigned int>(state.maxFrames),
+                                           state.kernel.renderFeatures().gainReductionTrace ? Py_True : Py_False);
+    if (fork == nullptr) {
+        return nullptr;
+    }
+    KernelState& forkState = *reinterpret_cast<KernelObject*>(fork)->state;
+    VXAtomKernelSnapshot snapshot;
+    state.kernel.saveSnapshot(snapshot);
+    forkState.kernel.restoreSnapshot(snapshot);
+    forkState.kernel.applySnapshotParameters(snapshot);
+    forkState.sampleTime = state.sampleTime;
+    return fork;
+}
+
+PyObject* Kernel_set_parameter(KernelObject* self, PyObject* args) {
+    unsigned long long address;
+    float value;
+    if (!PyArg_ParseTuple(args, "Kf", &address, &value) || !checkReady(self)) {
+        return nullptr;
+    }
+    self->state->kernel.setParameter(static_cast<AUParameterAddress>(address), value);
+    Py_RETURN_NONE;
+}
+
+PyObject* Kernel_get_parameter(KernelObject* self, PyObject* args) {
+    unsigned long long address;
+    if (!PyArg_ParseTuple(args, "K", &address) || !checkReady(self)) {
+        return nullptr;
+    }
+    return PyFloat_FromDouble(self->state->kernel.getParameter(static_cast<AUParameterAddress>(address)));
+}
+
+PyObject* Kernel_get_gain_reduction_db(KernelObject* self, void*) {
+    if (!checkReady(self)) {
+        return nullptr;
+    }
+    return PyFloat_FromDouble(self->state->kernel.getGainReductionDB());
+}
+
+PyObject* Kernel_get_footprint(KernelObject* self, void*) {
+    if (!checkReady(self)) {
+        return nullptr;
+    }
+    return PyLong_FromSize_t(self->state->kernel.renderMemoryFootprint());
+}
+
+PyObject* Kernel_get_channels(KernelObject* self, void*) {
+    return self->state ? PyLong_FromLong(self->state->channelCount) : Py_NewRef(Py_None);
+}
+
+PyObject* Kernel_get_sample_rate(KernelObject* self, void*) {
+    return self->state ? PyFloat_FromDouble(self->state->sampleRate) : Py_NewRef(Py_None);
+}
+
+PyObject* Kernel_get_max_frames(KernelObject* self, void*) {
+    return self->state ? PyLong_FromUnsignedLong(self->state->maxFrames) : Py_NewRef(Py_None);
+}
+
+PyMethodDef Kernel_methods[] = {
+    { "process", reinterpret_cast<PyCFunction>(reinterpret_cast<void(*)()>(Kernel_process)), METH_VARARGS | METH_KEYWORDS,
+      "process(audio, trace=None)\n"
+      "Compress a float32 (frames,) or (channels, frames) buffer in place. Interleaved audio\n"
+      "can be passed as a transposed view, e.g. interleaved.T, without copying. If trace is\n"
+      "given (same shape, kernel created with trace=True) it receives per-sample gain\n"
+      "reduction in positive dB, copied from the kernel's trace block by block." },
+    { "reset", reinterpret_cast<PyCFunction>(Kernel_reset), METH_NOARGS,
+      "Clear envelope, gate and meter state, as when the host reallocates render resources." },
+    { "snapshot", reinterpret_cast<PyCFunction>(Kernel_snapshot), METH_NOARGS,
+      "snapshot() -> bytes\n"
+      "Versioned binary snapshot of the full DSP state (parameters, envelopes, gate, meter)." },
+    { "restore", reinterpret_cast<PyCFunction>(Kernel_restore), METH_VARARGS,
+      "restore(snapshot)\n"
+      "Replace the DSP state and parameters with a snapshot taken at the same sample rate and\n"
+      "channel count. Raises ValueError for a corrupt snapshot or one that does not match." },
+    { "fork", reinterpret_cast<PyCFunction>(Kernel_fork), METH_NOARGS,
+      "fork() -> Kernel\n"
+      "New kernel with the same configuration, resuming from this kernel's current state." },
+    { "set_parameter", reinterpret_cast<PyCFunction>(Kernel_set_parameter), METH_VARARGS,
+      "set_parameter(address, value)" },
+    { "get_parameter", reinterpret_cast<PyCFunction>(Kernel_get_parameter), METH_VARARGS,
+      "get_parameter(address) -> float" },
+    { nullptr, nullptr, 0, nullptr }
+};
+
+PyGetSetDef Kernel_getset[] = {
+    { "gain_reduction_db", reinterpret_cast<getter>(Kernel_get_gain_reduction_db), nullptr,
+      "VU-smoothed gain reduction of channel 0 in positive dB.", nullptr },
+    { "footprint", reinterpret_cast<getter>(Kernel_get_footprint), nullptr,
+      "Bytes of render scratch memory held by the kernel.", nullptr },
+    { "channels", reinterpret_cast<getter>(Kernel_get_channels), nullptr, nullptr, nullptr },
+    { "sample_rate", reinterpret_cast<getter>(Kernel_get_sample_rate), nullptr, nullptr, nullptr },
+    { "max_frames", reinterpret_cast<getter>(Kernel_get_max_frames), nullptr, nullptr, nullptr },
+    { nullptr, nullptr, nullptr, nullptr, nullptr }
+};
+
+PyTypeObject KernelType = {
+    PyVarObject_HEAD_INIT(nullptr, 0)
+};
+
+PyModuleDef vxatomModule = {
+    PyModuleDef_HEAD_INIT,
+    "vxatom",
+    "VX-ATOM character compressor DSP kernel.",
+    -1,
+    nullptr
+};
+
+} // namespace
+
+PyMODINIT_FUNC PyInit_vxatom(void) {
+    KernelType.tp_name      = "vxatom.Kernel";
+    KernelType.tp_doc       = "Kernel(sample_rate=44100.0, channels=2, max_frames=1024, trace=False)\n"
+                              "One VX-ATOM DSP kernel. Separate instances may render concurrently.";
+    KernelType.tp_basicsize = sizeof(KernelObject);
+    KernelType.tp_flags     = Py_TPFLAGS_DEFAULT;
+    KernelType.tp_new       = PyType_GenericNew;
+    KernelType.tp_init      = reinterpret_cast<initproc>(Kernel_init);
+    KernelType.tp_dealloc   = reinterpret_cast<destructor>(Kernel_dealloc);
+    KernelType.tp_methods   = Kernel_methods;
+    KernelType.tp_getset    = Kernel_getset;
+    if (PyType_Ready(&KernelType) < 0) {
+        return nullptr;
+    }
+
+    PyObject* module = PyModule_Create(&vxatomModule);
+    if (module == nullptr) {
+        return nullptr;
+    }
+    if (PyModule_AddObjectRef(module, "Kernel", reinterpret_cast<PyObject*>(&KernelType)) < 0
+        || PyModule_AddIntConstant(module, "COMPRESS",    VXAtomExtensionParameterAddress::compress) < 0
+        || PyModule_AddIntConstant(module, "SPEED",       VXAtomExtensionParameterAddress::speed) < 0
+        || PyModule_AddIntConstant(module, "GATE",        VXAtomExtensionParameterAddress::gate) < 0
+        || PyModule_AddIntConstant(module, "OUTPUT_GAIN", VXAtomExtensionParameterAddress::outputGain) < 0
+        || PyModule_AddIntConstant(module, "MIX",         VXAtomExtensionParameterAddress::mix) < 0
+        || PyModule_AddIntConstant(module, "BYPASS",      VXAtomExtensionParameterAddress::bypass) < 0) {
+        Py_DECREF(module);
+        return nullptr;
+    }
+    return module;
+}
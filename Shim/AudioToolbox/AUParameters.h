@@ -0,0 +1,19 @@
+//
+//  AUParameters.h (Linux shim)
+//  VXAtomExtension
+//
+//  Parameter scalar types and NS_ENUM for VX-AtomExtensionParameterAddresses.h.
+//
+
+#pragma once
+
+#include <cstdint>
+
+typedef uint64_t AUParameterAddress;
+typedef float    AUValue;
+
+// `typedef NS_ENUM(T, Name) { ... };` expands to a typedef of the raw type followed by the
+// enum itself, which GCC accepts without the "typedef ignored" warning.
+#ifndef NS_ENUM
+#define NS_ENUM(_type, _name) _type _name##RawValue; enum _name : _type
+#endif
@@ -0,0 +1,54 @@
+//
+//  AudioToolbox.h (Linux shim)
+//  VXAtomExtension
+//
+//  Just enough of the AudioToolbox / AUAudioUnit C types for the DSP kernel to compile
+//  off-Apple, so the Python bindings can build on Linux. Layouts mirror the SDK headers.
+//  Only used by the Python module and the kernel tests; the plugin uses the real framework.
+//
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+#include "AUParameters.h"
+
+typedef uint8_t  UInt8;
+typedef uint32_t UInt32;
+typedef int32_t  OSStatus;
+
+typedef uint32_t AUAudioFrameCount;
+typedef int64_t  AUEventSampleTime;
+
+typedef uint8_t AURenderEventType;
+enum : AURenderEventType {
+    AURenderEventParameter        = 1,
+    AURenderEventParameterRamp    = 2,
+    AURenderEventMIDI             = 8,
+    AURenderEventMIDISysEx        = 9
+};
+
+union AURenderEvent;
+
+struct AURenderEventHeader {
+    union AURenderEvent* next;
+    AUEventSampleTime    eventSampleTime;
+    AURenderEventType    eventType;
+    UInt8                reserved;
+};
+
+struct AUParameterEvent {
+    union AURenderEvent* next;
+    AUEventSampleTime    eventSampleTime;
+    AURenderEventType    eventType;
+    UInt8                reserved[3];
+    AUAudioFrameCount    rampDurationSampleFrames;
+    AUParameterAddress   parameterAddress;
+    AUValue              value;
+};
+
+union AURenderEvent {
+    AURenderEventHeader head;
+    AUParameterEvent    parameter;
+};
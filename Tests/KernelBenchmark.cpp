@@ -0,0 +1,133 @@
+//
+//  KernelBenchmark.cpp
+//  VXAtomExtension
+//
+//  Render-cost benchmark for VXAtomExtensionDSPKernel::process() across buffer layouts:
+//  planar vs interleaved, and the bypass path with and without aliasing.
+//  Reports nanoseconds per sample-frame. Pass --quick for a short smoke run.
+//
+//  Channel views are built once, outside the timed loop, and only re-pointed per block,
+//  so the timings cover the kernel rather than view allocation.
+//
+
+#include <chrono>
+#include <cstring>
+#include <functional>
+
+#include "TestSupport.hpp"
+
+namespace {
+
+constexpr double kSampleRate = 48000.0;
+constexpr UInt32 kChannels   = 2;
+constexpr UInt32 kBlock      = 512;
+constexpr UInt32 kBlocks     = 16;  // cycled through, so successive renders touch different memory
+
+using InputViews  = std::vector<VXAtomChannelView<float const>>;
+using OutputViews = std::vector<VXAtomChannelView<float>>;
+
+struct Layout {
+    std::vector<std::vector<float>> planarIn;
+    std::vector<std::vector<float>> planarOut;
+    std::vector<float>              interleaved;
+
+    // Views at block 0; rendering offsets copies of them into the per-block views below.
+    InputViews  planarInBase, interleavedInBase;
+    OutputViews planarInPlaceBase, planarOutBase, interleavedOutBase;
+    InputViews  in;
+    OutputViews out;
+
+    Layout()
+    : planarIn(kChannels, std::vector<float>(kBlock * kBlocks)),
+      planarOut(kChannels, std::vector<float>(kBlock * kBlocks)),
+      interleaved(kChannels * kBlock * kBlocks),
+      in(kChannels),
+      out(kChannels) {
+        for (UInt32 ch = 0; ch < kChannels; ++ch) {
+            for (UInt32 i = 0; i < kBlock * kBlocks; ++i) {
+                planarIn[ch][i] = testSample(ch, i, kSampleRate);
+                interleaved[i * kChannels + ch] = planarIn[ch][i];
+            }
+        }
+        planarInBase       = planarViews<float const>(planarIn);
+        planarInPlaceBase  = planarViews<float>(planarIn);
+        planarOutBase      = planarViews<float>(planarOut);
+        interleavedInBase  = interleavedViews<float const>(interleaved, kChannels);
+        interleavedOutBase = interleavedViews<float>(interleaved, kChannels);
+    }
+
+    Layout(Layout const&) = delete;  // the views point into this object's vectors
+
+    // Points `in` / `out` at `block`, without allocating.
+    void select(InputViews const& inBase, OutputViews const& outBase, UInt32 block) {
+        for (UInt32 ch = 0; ch < kChannels; ++ch) {
+            in[ch]  = { inBase[ch].data  + static_cast<size_t>(block) * kBlock * inBase[ch].stride,  inBase[ch].stride };
+            out[ch] = { outBase[ch].data + static_cast<size_t>(block) * kBlock * outBase[ch].stride, outBase[ch].stride };
+        }
+    }
+};
+
+void run(char const* name, int blocks, float mix, bool bypass,
+         std::function<void(VXAtomExtensionDSPKernel&, Layout&, UInt32)> const& renderBlock) {
+    VXAtomExtensionDSPKernel kernel;
+    kernel.setMaximumFramesToRender(kBlock);
+    kernel.initialize(kChannels, kChannels, kSampleRate);
+    kernel.setParameter(VXAtomExtensionParameterAddress::compress, 8.0f);
+    kernel.setParameter(VXAtomExtensionParameterAddress::mix, mix);
+    kernel.setParameter(VXAtomExtensionParameterAddress::bypass, bypass ? 1.0f : 0.0f);
+
+    Layout layout;
+    const auto start = std::chrono::steady_clock::now();
+    for (int block = 0; block < blocks; ++block) {
+        renderBlock(kernel, layout, static_cast<UInt32>(block) % kBlocks);
+    }
+    const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+    std::printf("%-34s %8.2f ns/frame\n", name, elapsed.count() / (static_cast<double>(blocks) * kBlock));
+}
+
+void renderPlanarInPlace(VXAtomExtensionDSPKernel& kernel, Layout& layout, UInt32 block) {
+    layout.select(layout.planarInBase, layout.planarInPlaceBase, block);
+    kernel.process(layout.in, layout.out, 0, kBlock);
+}
+
+void renderPlanarOutOfPlace(VXAtomExtensionDSPKernel& kernel, Layout& layout, UInt32 block) {
+    layout.select(layout.planarInBase, layout.planarOutBase, block);
+    kernel.process(layout.in, layout.out, 0, kBlock);
+}
+
+void renderInterleavedInPlace(VXAtomExtensionDSPKernel& kernel, Layout& layout, UInt32 block) {
+    layout.select(layout.interleavedInBase, layout.interleavedOutBase, block);
+    kernel.process(layout.in, layout.out, 0, kBlock);
+}
+
+// What interleaved input cost before strided views: deinterleave, render planar, reinterleave.
+void renderInterleavedViaCopies(VXAtomExtensionDSPKernel& kernel, Layout& layout, UInt32 block) {
+    const size_t first = static_cast<size_t>(block) * kBlock;
+    for (size_t i = first; i < first + kBlock; ++i) {
+        for (UInt32 ch = 0; ch < kChannels; ++ch) {
+            layout.planarIn[ch][i] = layout.interleaved[i * kChannels + ch];
+        }
+    }
+    renderPlanarInPlace(kernel, layout, block);
+    for (size_t i = first; i < first + kBlock; ++i) {
+        for (UInt32 ch = 0; ch < kChannels; ++ch) {
+            layout.interleaved[i * kChannels + ch] = layout.planarIn[ch][i];
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+    const int  blocks = quick ? 64 : 20000;
+
+    run("process planar in-place",        blocks, 1.0f, false, renderPlanarInPlace);
+    run("process planar out-of-place",    blocks, 1.0f, false, renderPlanarOutOfPlace);
+    run("process interleaved in-place",   blocks, 1.0f, false, renderInterleavedInPlace);
+    run("process interleaved via copies", blocks, 1.0f, false, renderInterleavedViaCopies);
+    run("bypass in-place (aliased)",      blocks, 1.0f, true,  renderPlanarInPlace);
+    run("bypass out-of-place (copy)",     blocks, 1.0f, true,  renderPlanarOutOfPlace);
+    run("bypass interleaved (aliased)",   blocks, 1.0f, true,  renderInterleavedInPlace);
+    return 0;
+}
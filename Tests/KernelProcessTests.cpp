@@ -0,0 +1,170 @@
+//
+//  KernelProcessTests.cpp
+//  VXAtomExtension
+//
+//  Buffer-layout coverage for VXAtomExtensionDSPKernel::process(): strided (interleaved)
+//  views must render exactly like planar ones, and bypass and MIX 0 must be correct whether
+//  or not the output aliases the input.
+//
+
+#include "TestSupport.hpp"
+
+namespace {
+
+constexpr double   kSampleRate = 48000.0;
+constexpr UInt32   kChannels   = 2;
+constexpr UInt32   kBlock      = 256;
+constexpr UInt32   kBlocks     = 64;
+
+VXAtomExtensionDSPKernel makeKernel(float compress, float mix, bool bypass = false) {
+    VXAtomExtensionDSPKernel kernel;
+    kernel.setMaximumFramesToRender(kBlock);
+    kernel.initialize(kChannels, kChannels, kSampleRate);
+    kernel.setParameter(VXAtomExtensionParameterAddress::compress, compress);
+    kernel.setParameter(VXAtomExtensionParameterAddress::speed, 7.0f);
+    kernel.setParameter(VXAtomExtensionParameterAddress::gate, 2.0f);
+    kernel.setParameter(VXAtomExtensionParameterAddress::mix, mix);
+    kernel.setParameter(VXAtomExtensionParameterAddress::bypass, bypass ? 1.0f : 0.0f);
+    return kernel;
+}
+
+std::vector<std::vector<float>> planarSignal() {
+    std::vector<std::vector<float>> channels(kChannels, std::vector<float>(kBlock * kBlocks));
+    for (UInt32 ch = 0; ch < kChannels; ++ch) {
+        for (UInt32 i = 0; i < kBlock * kBlocks; ++i) {
+            channels[ch][i] = testSample(ch, i, kSampleRate);
+        }
+    }
+    return channels;
+}
+
+std::vector<float> interleave(std::vector<std::vector<float>> const& channels) {
+    std::vector<float> interleaved(kChannels * channels[0].size());
+    for (size_t i = 0; i < channels[0].size(); ++i) {
+        for (UInt32 ch = 0; ch < kChannels; ++ch) {
+            interleaved[i * kChannels + ch] = channels[ch][i];
+        }
+    }
+    return interleaved;
+}
+
+// Renders planar audio in place, block by block.
+void renderPlanarInPlace(VXAtomExtensionDSPKernel& kernel, std::vector<std::vector<float>>& audio) {
+    for (UInt32 block = 0; block < kBlocks; ++block) {
+        auto in  = planarViews<float const>(audio, block * kBlock);
+        auto out = planarViews<float>(audio, block * kBlock);
+        kernel.process(in, out, block * kBlock, kBlock);
+    }
+}
+
+// Renders planar audio into a separate output, block by block.
+void renderPlanarOutOfPlace(VXAtomExtensionDSPKernel& kernel, std::vector<std::vector<float>>& input,
+                            std::vector<std::vector<float>>& output) {
+    for (UInt32 block = 0; block < kBlocks; ++block) {
+        auto in  = planarViews<float const>(input, block * kBlock);
+        auto out = planarViews<float>(output, block * kBlock);
+        kernel.process(in, out, block * kBlock, kBlock);
+    }
+}
+
+void testInterleavedMatchesPlanar() {
+    for (float mix : { 1.0f, 0.5f, 0.0f }) {
+        auto planar      = planarSignal();
+        auto interleaved = interleave(planar);
+
+        auto planarKernel      = makeKernel(8.0f, mix);
+        auto interleavedKernel = makeKernel(8.0f, mix);
+
+        renderPlanarInPlace(planarKernel, planar);
+        for (UInt32 block = 0; block < kBlocks; ++block) {
+            auto in  = interleavedViews<float const>(interleaved, kChannels, block * kBlock);
+            auto out = interleavedViews<float>(interleaved, kChannels, block * kBlock);
+            interleavedKernel.process(in, out, block * kBlock, kBlock);
+        }
+
+        EXPECT(interleave(planar) == interleaved);
+        EXPECT(planarKernel.getGainReductionDB() == interleavedKernel.getGainReductionDB());
+    }
+}
+
+void testInPlaceMatchesOutOfPlace() {
+    for (float mix : { 1.0f, 0.0f }) {
+        auto inPlace = planarSignal();
+        auto input   = planarSignal();
+        std::vector<std::vector<float>> output(kChannels, std::vector<float>(kBlock * kBlocks, -1.0f));
+
+        auto inPlaceKernel    = makeKernel(6.0f, mix);
+        auto outOfPlaceKernel = makeKernel(6.0f, mix);
+        renderPlanarInPlace(inPlaceKernel, inPlace);
+        renderPlanarOutOfPlace(outOfPlaceKernel, input, output);
+
+        EXPECT(inPlace == output);
+    }
+}
+
+void testBypassPassThrough() {
+    const auto reference = planarSignal();
+
+    // Aliased: the samples must be left exactly where they are.
+    auto aliased = planarSignal();
+    auto aliasedKernel = makeKernel(8.0f, 1.0f, true);
+    renderPlanarInPlace(aliasedKernel, aliased);
+    EXPECT(aliased == reference);
+    EXPECT(aliasedKernel.getGainReductionDB() == 0.0f);
+
+    // Separate planar output: a straight copy.
+    auto input = planarSignal();
+    std::vector<std::vector<float>> output(kChannels, std::vector<float>(kBlock * kBlocks, -1.0f));
+    auto copyKernel = makeKernel(8.0f, 1.0f, true);
+    renderPlanarOutOfPlace(copyKernel, input, output);
+    EXPECT(output == reference);
+
+    // Planar input into an interleaved output: a strided copy.
+    std::vector<float> interleavedOutput(kChannels * kBlock * kBlocks, -1.0f);
+    auto stridedKernel = makeKernel(8.0f, 1.0f, true);
+    for (UInt32 block = 0; block < kBlocks; ++block) {
+        auto in  = planarViews<float const>(input, block * kBlock);
+        auto out = interleavedViews<float>(interleavedOutput, kChannels, block * kBlock);
+        stridedKernel.process(in, out, block * kBlock, kBlock);
+    }
+    EXPECT(interleavedOutput == interleave(reference));
+}
+
+// MIX 0 has no shortcut: the gate and detectors keep running so bringing MIX back up
+// continues from warm envelopes, exactly like an out-of-place render.
+void testDryInPlaceKeepsDetectorsWarm() {
+    auto inPlace = planarSignal();
+    auto input   = planarSignal();
+    std::vector<std::vector<float>> output(kChannels, std::vector<float>(kBlock * kBlocks, -1.0f));
+
+    auto inPlaceKernel    = makeKernel(8.0f, 0.0f);
+    auto outOfPlaceKernel = makeKernel(8.0f, 0.0f);
+    for (UInt32 block = 0; block < kBlocks; ++block) {
+        if (block == kBlocks / 2) {
+            inPlaceKernel.setParameter(VXAtomExtensionParameterAddress::mix, 1.0f);
+            outOfPlaceKernel.setParameter(VXAtomExtensionParameterAddress::mix, 1.0f);
+        }
+        auto in1  = planarViews<float const>(inPlace, block * kBlock);
+        auto out1 = planarViews<float>(inPlace, block * kBlock);
+        inPlaceKernel.process(in1, out1, block * kBlock, kBlock);
+
+        auto in2  = planarViews<float const>(input, block * kBlock);
+        auto out2 = planarViews<float>(output, block * kBlock);
+        outOfPlaceKernel.process(in2, out2, block * kBlock, kBlock);
+
+        if (block == kBlocks / 2 - 1) {
+            EXPECT(inPlaceKernel.getGainReductionDB() > 0.0f);
+        }
+    }
+    EXPECT(inPlace == output);
+}
+
+} // namespace
+
+int main() {
+    testInterleavedMatchesPlanar();
+    testInPlaceMatchesOutOfPlace();
+    testBypassPassThrough();
+    testDryInPlaceKeepsDetectorsWarm();
+    return finishTests("KernelProcessTests");
+}
@@ -0,0 +1,332 @@
+//
+//  KernelSnapshotTests.cpp
+//  VXAtomExtension
+//
+//  VXAtomKernelSnapshot round trips, restore's handling of untrusted snapshot data, and the
+//  latest-wins hand-off of scheduled snapshots to the render thread.
+//
+
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#include "TestSupport.hpp"
+
+namespace {
+
+constexpr double kSampleRate = 48000.0;
+constexpr UInt32 kFrames     = 4096;
+
+VXAtomExtensionDSPKernel makeKernel(double sampleRate = kSampleRate) {
+    VXAtomExtensionDSPKernel kernel;
+    kernel.setMaximumFramesToRender(kFrames);
+    kernel.initialize(2, 2, sampleRate);
+    kernel.setParameter(VXAtomExtensionParameterAddress::compress, 8.0f);
+    kernel.setParameter(VXAtomExtensionParameterAddress::speed, 6.0f);
+    kernel.setParameter(VXAtomExtensionParameterAddress::gate, 3.0f);
+    return kernel;
+}
+
+std::vector<std::vector<float>> signal(long startFrame) {
+    std::vector<std::vector<float>> channels(2, std::vector<float>(kFrames));
+    for (int ch = 0; ch < 2; ++ch) {
+        for (UInt32 i = 0; i < kFrames; ++i) {
+            channels[ch][i] = testSample(ch, startFrame + i, kSampleRate);
+        }
+    }
+    return channels;
+}
+
+void render(VXAtomExtensionDSPKernel& kernel, std::vector<std::vector<float>>& audio) {
+    auto in  = planarViews<float const>(audio);
+    auto out = planarViews<float>(audio);
+    kernel.process(in, out, 0, kFrames);
+}
+
+// State after `blocks` blocks of the test signal, so different block counts give different snapshots.
+VXAtomKernelSnapshot warmSnapshot(int blocks = 1) {
+    auto kernel = makeKernel();
+    for (int block = 0; block < blocks; ++block) {
+        auto warmUp = signal(static_cast<long>(block) * kFrames);
+        render(kernel, warmUp);
+    }
+    VXAtomKernelSnapshot snapshot;
+    kernel.saveSnapshot(snapshot);
+    return snapshot;
+}
+
+void testRestoredKernelContinuesBitExact() {
+    auto original = makeKernel();
+    auto warmUp = signal(0);
+    render(original, warmUp);
+
+    VXAtomKernelSnapshot snapshot;
+    original.saveSnapshot(snapshot);
+
+    VXAtomExtensionDSPKernel restored;
+    restored.setMaximumFramesToRender(kFrames);
+    restored.initialize(2, 2, kSampleRate);
+    EXPECT(restored.restoreSnapshot(snapshot));
+    EXPECT(restored.applySnapshotParameters(snapshot));
+    EXPECT(restored.getParameter(VXAtomExtensionParameterAddress::compress) == 8.0f);
+
+    auto a = signal(kFrames);
+    auto b = signal(kFrames);
+    render(original, a);
+    render(restored, b);
+    EXPECT(a == b);
+    EXPECT(original.getGainReductionDB() == restored.getGainReductionDB());
+}
+
+void testSnapshotBytesAreFullyDefined() {
+    auto kernel = makeKernel();
+    std::vector<unsigned char> zeros(VXAtomExtensionDSPKernel::snapshotSize(), 0x00);
+    std::vector<unsigned char> ones(VXAtomExtensionDSPKernel::snapshotSize(), 0xFF);
+    EXPECT(kernel.writeSnapshot(zeros.data(), zeros.size()) == zeros.size());
+    EXPECT(kernel.writeSnapshot(ones.data(), ones.size()) == ones.size());
+    EXPECT(zeros == ones);
+    EXPECT(kernel.writeSnapshot(zeros.data(), zeros.size() - 1) == 0);
+}
+
+void testRejectsForeignSnapshots() {
+    auto kernel = makeKernel();
+
+    auto wrongVersion = warmSnapshot();
+    wrongVersion.version += 1;
+    EXPECT(!kernel.restoreSnapshot(wrongVersion));
+
+    auto wrongMagic = warmSnapshot();
+    wrongMagic.magic = 0;
+    EXPECT(!kernel.restoreSnapshot(wrongMagic));
+
+    auto otherRate = makeKernel(44100.0);
+    EXPECT(!otherRate.restoreSnapshot(warmSnapshot()));
+    EXPECT(!otherRate.applySnapshotParameters(warmSnapshot()));
+
+    // A mono snapshot must not half-restore a stereo kernel (channel 1 would keep stale state).
+    VXAtomExtensionDSPKernel mono;
+    mono.initialize(1, 1, kSampleRate);
+    VXAtomKernelSnapshot monoSnapshot;
+    mono.saveSnapshot(monoSnapshot);
+    EXPECT(monoSnapshot.channelCount == 1);
+    EXPECT(!kernel.restoreSnapshot(monoSnapshot));
+    EXPECT(!kernel.applySnapshotParameters(monoSnapshot));
+    EXPECT(mono.restoreSnapshot(monoSnapshot));
+
+    auto bytes = warmSnapshot();
+    EXPECT(!kernel.readSnapshot(&bytes, sizeof(bytes) - 1));
+    EXPECT(kernel.readSnapshot(&bytes, sizeof(bytes)));
+}
+
+void testRejectsCorruptState() {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+
+    std::vector<VXAtomKernelSnapshot> corrupt;
+    auto add = [&](auto mutate) {
+        auto snapshot = warmSnapshot();
+        mutate(snapshot);
+        corrupt.push_back(snapshot);
+    };
+    add([&](auto& s) { s.envelope[0]     = nan; });
+    add([&](auto& s) { s.envelope2[1]    = inf; });
+    add([&](auto& s) { s.envelope3[0]    = -1.0f; });
+    add([&](auto& s) { s.gateEnvelope[1] = nan; });
+    add([&](auto& s) { s.gateGain[0]     = 1.5f; });
+    add([&](auto& s) { s.meterSmoothed   = nan; });
+    add([&](auto& s) { s.compress        = nan; });
+    add([&](auto& s) { s.outputGainDB    = inf; });
+    add([&](auto& s) { s.bypassed        = 7; });
+    add([&](auto& s) { s.channelCount    = 0; });
+    add([&](auto& s) { s.channelCount    = 3; });
+
+    for (auto const& snapshot : corrupt) {
+        auto kernel = makeKernel();
+        VXAtomKernelSnapshot before;
+        kernel.saveSnapshot(before);
+
+        EXPECT(!kernel.restoreSnapshot(snapshot));
+        EXPECT(!kernel.applySnapshotParameters(snapshot));
+        EXPECT(!kernel.scheduleSnapshot(&snapshot, sizeof(snapshot)));
+
+        VXAtomKernelSnapshot after;
+        kernel.saveSnapshot(after);
+        EXPECT(std::memcmp(&before, &after, sizeof(before)) == 0);  // left untouched
+    }
+}
+
+void testClampsOutOfRangeParameters() {
+    auto snapshot = warmSnapshot();
+    snapshot.compress     = 1e9f;
+    snapshot.speed        = -50.0f;
+    snapshot.outputGainDB = 1000.0f;
+    snapshot.mix          = 3.0f;
+
+    auto kernel = makeKernel();
+    EXPECT(kernel.applySnapshotParameters(snapshot));
+    EXPECT(kernel.getParameter(VXAtomExtensionParameterAddress::compress)   == 10.0f);
+    EXPECT(kernel.getParameter(VXAtomExtensionParameterAddress::speed)      == 0.0f);
+    EXPECT(kernel.getParameter(VXAtomExtensionParameterAddress::outputGain) == 24.0f);
+    EXPECT(kernel.getParameter(VXAtomExtensionParameterAddress::mix)        == 1.0f);
+
+    auto audio = signal(kFrames);
+    render(kernel, audio);
+    for (auto const& channel : audio) {
+        for (float sample : channel) {
+            EXPECT(std::isfinite(sample));
+        }
+    }
+}
+
+// The AU restores DSP state only; the parameter tree stays authoritative for parameters.
+void testStateRestoreLeavesParametersAlone() {
+    auto snapshot = warmSnapshot();  // COMPRESS 8
+
+    auto kernel = makeKernel();
+    kernel.setParameter(VXAtomExtensionParameterAddress::compress, 2.0f);
+    kernel.setParameter(VXAtomExtensionParameterAddress::bypass, 1.0f);
+    EXPECT(kernel.restoreSnapshot(snapshot));
+    EXPECT(kernel.getParameter(VXAtomExtensionParameterAddress::compress) == 2.0f);
+    EXPECT(kernel.getParameter(VXAtomExtensionParameterAddress::bypass) == 1.0f);
+
+    VXAtomKernelSnapshot after;
+    kernel.saveSnapshot(after);
+    EXPECT(std::memcmp(after.envelope, snapshot.envelope, sizeof(after.envelope)) == 0);
+    EXPECT(after.meterSmoothed == snapshot.meterSmoothed);
+}
+
+// A scheduled snapshot is applied by the render thread at the top of the next process() call,
+// and renders exactly like a direct restore.
+void testScheduledSnapshotAppliesOnNextRender() {
+    auto snapshot = warmSnapshot();
+
+    auto direct    = makeKernel();
+    auto scheduled = makeKernel();
+    EXPECT(direct.restoreSnapshot(snapshot));
+    EXPECT(scheduled.scheduleSnapshot(&snapshot, sizeof(snapshot)));
+
+    VXAtomKernelSnapshot beforeRender;
+    scheduled.saveSnapshot(beforeRender);
+    EXPECT(beforeRender.envelope[0] != snapshot.envelope[0]);  // not applied off the render thread
+
+    auto a = signal(kFrames);
+    auto b = signal(kFrames);
+    render(direct, a);
+    render(scheduled, b);
+    EXPECT(a == b);
+}
+
+// Latest wins: a second snapshot scheduled before a render replaces the first.
+void testLaterScheduledSnapshotWins() {
+    auto older = warmSnapshot(1);
+    auto newer = warmSnapshot(3);
+    EXPECT(older.envelope[0] != newer.envelope[0]);
+
+    auto kernel = makeKernel();
+    auto direct = makeKernel();
+    EXPECT(kernel.scheduleSnapshot(&older, sizeof(older)));
+    EXPECT(kernel.scheduleSnapshot(&newer, sizeof(newer)));
+    EXPECT(direct.restoreSnapshot(newer));
+
+    auto a = signal(kFrames);
+    auto b = signal(kFrames);
+    render(kernel, a);
+    render(direct, b);
+    EXPECT(a == b);
+}
+
+// A snapshot scheduled but never rendered must not survive reallocation and override the
+// state restored afterwards (schedule A, schedule B, deallocate, reallocate, read B, render).
+void testReallocationDropsUnappliedSnapshot() {
+    auto older = warmSnapshot(1);
+    auto newer = warmSnapshot(3);
+
+    auto kernel = makeKernel();
+    EXPECT(kernel.scheduleSnapshot(&older, sizeof(older)));
+    EXPECT(kernel.scheduleSnapshot(&newer, sizeof(newer)));
+    kernel.deInitialize();
+    kernel.initialize(2, 2, kSampleRate);
+    EXPECT(kernel.readSnapshot(&newer, sizeof(newer)));
+
+    auto direct = makeKernel();
+    EXPECT(direct.restoreSnapshot(newer));
+
+    auto a = signal(kFrames);
+    auto b = signal(kFrames);
+    render(kernel, a);
+    render(direct, b);
+    EXPECT(a == b);
+
+    // initialize() alone (a re-format without deInitialize) drops it too.
+    EXPECT(kernel.scheduleSnapshot(&older, sizeof(older)));
+    kernel.initialize(2, 2, kSampleRate);
+    auto c = signal(0);
+    auto d = signal(0);
+    auto fresh = makeKernel();
+    render(kernel, c);
+    render(fresh, d);
+    EXPECT(c == d);
+}
+
+// Producer and consumer on separate threads: the consumer only ever moves forward and
+// ends on the last value posted.
+void testMailboxAcrossThreads() {
+    constexpr int kPosts = 200000;
+    VXAtomMailbox<std::array<int, 16>> mailbox;
+
+    std::thread producer([&] {
+        for (int value = 1; value <= kPosts; ++value) {
+            std::array<int, 16> message;
+            message.fill(value);
+            mailbox.post(message);
+        }
+    });
+
+    int last = 0;
+    bool consistent = true;
+    while (last < kPosts) {
+        if (auto const* message = mailbox.take()) {
+            const int value = (*message)[0];
+            for (int item : *message) {
+                consistent = consistent && item == value;  // never torn
+            }
+            consistent = consistent && value > last;    // never stale
+            last = value;
+        }
+    }
+    producer.join();
+
+    EXPECT(consistent);
+    EXPECT(last == kPosts);
+    EXPECT(mailbox.take() == nullptr);
+}
+
+void testScheduledSnapshotAtOtherRateIsDropped() {
+    auto snapshot = warmSnapshot();
+    auto kernel   = makeKernel(44100.0);
+    auto fresh    = makeKernel(44100.0);
+    EXPECT(kernel.scheduleSnapshot(&snapshot, sizeof(snapshot)));
+
+    auto a = signal(0);
+    auto b = signal(0);
+    render(kernel, a);
+    render(fresh, b);
+    EXPECT(a == b);
+}
+
+} // namespace
+
+int main() {
+    testRestoredKernelContinuesBitExact();
+    testSnapshotBytesAreFullyDefined();
+    testRejectsForeignSnapshots();
+    testRejectsCorruptState();
+    testClampsOutOfRangeParameters();
+    testStateRestoreLeavesParametersAlone();
+    testScheduledSnapshotAppliesOnNextRender();
+    testScheduledSnapshotAtOtherRateIsDropped();
+    testLaterScheduledSnapshotWins();
+    testReallocationDropsUnappliedSnapshot();
+    testMailboxAcrossThreads();
+    return finishTests("KernelSnapshotTests");
+}
@@ -0,0 +1,210 @@
+//
+//  RenderArenaTests.cpp
+//  VXAtomExtension
+//
+//  Guarantees of VXAtomRenderArena and the kernel's use of it: 64-byte-aligned,
+//  non-overlapping slices, a footprint that follows the current plan (zero when no render
+//  features are enabled), and a gain-reduction trace that does not change the rendered audio.
+//
+
+#include <algorithm>
+#include <cstdint>
+
+#include "TestSupport.hpp"
+
+namespace {
+
+bool isAligned(void const* pointer) {
+    return reinterpret_cast<uintptr_t>(pointer) % VXAtomRenderArena::kAlignment == 0;
+}
+
+template <typename A, typename B>
+bool overlaps(std::span<A> a, std::span<B> b) {
+    auto const* aBegin = reinterpret_cast<std::byte const*>(a.data());
+    auto const* bBegin = reinterpret_cast<std::byte const*>(b.data());
+    return aBegin < bBegin + b.size_bytes() && bBegin < aBegin + a.size_bytes();
+}
+
+void testSlicesAreAlignedAndDisjoint() {
+    const size_t counts[] = { 1, 3, 16, 17, 100, 1024 };
+
+    size_t total = 0;
+    for (size_t count : counts) {
+        total += VXAtomRenderArena::alignedSize<float>(count) + VXAtomRenderArena::alignedSize<double>(count);
+    }
+
+    VXAtomRenderArena arena;
+    arena.reserve(total);
+    EXPECT(arena.capacityBytes() == total);
+
+    std::vector<std::span<float>>  floats;
+    std::vector<std::span<double>> doubles;
+    for (size_t count : counts) {
+        floats.push_back(arena.data<float>(arena.allocate<float>(count)));
+        doubles.push_back(arena.data<double>(arena.allocate<double>(count)));
+    }
+    EXPECT(arena.usedBytes() == total);
+
+    for (size_t i = 0; i < floats.size(); ++i) {
+        EXPECT(floats[i].size() == counts[i]);
+        EXPECT(doubles[i].size() == counts[i]);
+        EXPECT(isAligned(floats[i].data()));
+        EXPECT(isAligned(doubles[i].data()));
+        EXPECT(!overlaps(floats[i], doubles[i]));
+        for (size_t j = i + 1; j < floats.size(); ++j) {
+            EXPECT(!overlaps(floats[i], floats[j]));
+            EXPECT(!overlaps(floats[i], doubles[j]));
+            EXPECT(!overlaps(doubles[i], floats[j]));
+            EXPECT(!overlaps(doubles[i], doubles[j]));
+        }
+    }
+
+    // Writes through one slice never show up in another.
+    for (auto& slice : floats) {
+        std::fill(slice.begin(), slice.end(), 1.0f);
+    }
+    for (auto& slice : doubles) {
+        for (double value : slice) {
+            EXPECT(value == 0.0);
+        }
+    }
+
+    // The plan is exhausted: further slices come back empty instead of aliasing.
+    EXPECT(arena.allocate<float>(1).count == 0);
+    EXPECT(arena.data<float>(arena.allocate<float>(1)).empty());
+}
+
+void testCopiedArenaStaysAligned() {
+    VXAtomRenderArena arena;
+    arena.reserve(VXAtomRenderArena::alignedSize<float>(64) * 2);
+    const auto first  = arena.allocate<float>(64);
+    const auto second = arena.allocate<float>(64);
+
+    for (int attempt = 0; attempt < 8; ++attempt) {
+        std::vector<char> padding(attempt * 8 + 1);  // shift where the next heap block lands
+        VXAtomRenderArena copy = arena;
+        EXPECT(isAligned(copy.data<float>(first).data()));
+        EXPECT(isAligned(copy.data<float>(second).data()));
+        EXPECT(!overlaps(copy.data<float>(first), copy.data<float>(second)));
+    }
+}
+
+void testFootprint() {
+    VXAtomRenderArena empty;
+    empty.reserve(0);
+    EXPECT(empty.footprintBytes() == 0);
+
+    VXAtomExtensionDSPKernel plain;
+    plain.initialize(2, 2, 48000.0);
+    EXPECT(plain.renderMemoryFootprint() == 0);
+    EXPECT(plain.gainReductionTrace(0).empty());
+
+    VXAtomExtensionDSPKernel traced;
+    traced.setMaximumFramesToRender(512);
+    traced.setRenderFeatures({ .gainReductionTrace = true });
+    traced.initialize(2, 2, 48000.0);
+    EXPECT(traced.renderMemoryFootprint() >= 2 * 512 * sizeof(float));
+
+    traced.deInitialize();
+    EXPECT(traced.renderMemoryFootprint() == 0);
+}
+
+// Re-planning smaller (a re-initialize with fewer max frames, no deInitialize in between)
+// must give memory back rather than keep reporting the old block.
+void testSmallerPlanShrinksFootprint() {
+    VXAtomRenderArena arena;
+    arena.reserve(VXAtomRenderArena::alignedSize<float>(4096));
+    const size_t large = arena.footprintBytes();
+    arena.reserve(VXAtomRenderArena::alignedSize<float>(64));
+    EXPECT(arena.footprintBytes() < large);
+    EXPECT(arena.footprintBytes() < VXAtomRenderArena::alignedSize<float>(64) + 2 * VXAtomRenderArena::kAlignment);
+    EXPECT(isAligned(arena.data<float>(arena.allocate<float>(64)).data()));
+
+    VXAtomExtensionDSPKernel kernel;
+    kernel.setRenderFeatures({ .gainReductionTrace = true });
+    kernel.setMaximumFramesToRender(4096);
+    kernel.initialize(2, 2, 48000.0);
+    const size_t before = kernel.renderMemoryFootprint();
+    kernel.setMaximumFramesToRender(256);
+    kernel.initialize(2, 2, 48000.0);
+    EXPECT(kernel.renderMemoryFootprint() < before);
+    EXPECT(kernel.renderMemoryFootprint() >= 2 * 256 * sizeof(float));
+}
+
+// Bypass reports no gain reduction for the frames it rendered.
+void testBypassClearsTrace() {
+    constexpr UInt32 kFrames = 256;
+    std::vector<std::vector<float>> audio(2, std::vector<float>(kFrames));
+    for (UInt32 ch = 0; ch < 2; ++ch) {
+        for (UInt32 i = 0; i < kFrames; ++i) {
+            audio[ch][i] = testSample(ch, i);
+        }
+    }
+
+    VXAtomExtensionDSPKernel kernel;
+    kernel.setMaximumFramesToRender(kFrames);
+    kernel.setRenderFeatures({ .gainReductionTrace = true });
+    kernel.initialize(2, 2, 48000.0);
+
+    auto in  = planarViews<float const>(audio);
+    auto out = planarViews<float>(audio);
+    kernel.process(in, out, 0, kFrames);
+    EXPECT(*std::max_element(kernel.gainReductionTrace(1).begin(), kernel.gainReductionTrace(1).end()) > 0.0f);
+
+    kernel.setParameter(VXAtomExtensionParameterAddress::bypass, 1.0f);
+    kernel.process(in, out, 0, kFrames / 2);
+    for (int ch = 0; ch < 2; ++ch) {
+        auto trace = kernel.gainReductionTrace(ch);
+        EXPECT(trace.size() == kFrames / 2);
+        EXPECT(std::all_of(trace.begin(), trace.end(), [](float value) { return value == 0.0f; }));
+    }
+}
+
+// The trace must observe the render, not change it.
+void testTraceDoesNotChangeAudio() {
+    constexpr UInt32 kFrames = 512;
+    std::vector<std::vector<float>> plainAudio(2, std::vector<float>(kFrames));
+    for (UInt32 ch = 0; ch < 2; ++ch) {
+        for (UInt32 i = 0; i < kFrames; ++i) {
+            plainAudio[ch][i] = testSample(ch, i);
+        }
+    }
+    auto tracedAudio = plainAudio;
+
+    VXAtomExtensionDSPKernel plain;
+    plain.setMaximumFramesToRender(kFrames);
+    plain.initialize(2, 2, 48000.0);
+
+    VXAtomExtensionDSPKernel traced;
+    traced.setMaximumFramesToRender(kFrames);
+    traced.setRenderFeatures({ .gainReductionTrace = true });
+    traced.initialize(2, 2, 48000.0);
+
+    auto plainIn   = planarViews<float const>(plainAudio);
+    auto plainOut  = planarViews<float>(plainAudio);
+    auto tracedIn  = planarViews<float const>(tracedAudio);
+    auto tracedOut = planarViews<float>(tracedAudio);
+    plain.process(plainIn, plainOut, 0, kFrames);
+    traced.process(tracedIn, tracedOut, 0, kFrames);
+
+    EXPECT(plainAudio == tracedAudio);
+    for (int ch = 0; ch < 2; ++ch) {
+        auto trace = traced.gainReductionTrace(ch);
+        EXPECT(trace.size() == kFrames);
+        EXPECT(*std::max_element(trace.begin(), trace.end()) > 0.0f);
+    }
+    EXPECT(isAligned(traced.gainReductionTrace(0).data()));
+    EXPECT(!overlaps(traced.gainReductionTrace(0), traced.gainReductionTrace(1)));
+}
+
+} // namespace
+
+int main() {
+    testSlicesAreAlignedAndDisjoint();
+    testCopiedArenaStaysAligned();
+    testFootprint();
+    testSmallerPlanShrinksFootprint();
+    testBypassClearsTrace();
+    testTraceDoesNotChangeAudio();
+    return finishTests("RenderArenaTests");
+}
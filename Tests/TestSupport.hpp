@@ -0,0 +1,62 @@
+//
+//  TestSupport.hpp
+//  VXAtomExtension
+//
+//  Minimal check macros and signal helpers shared by the kernel tests.
+//
+
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "VX-AtomExtensionDSPKernel.hpp"
+
+inline int gFailures = 0;
+
+#define EXPECT(condition)                                                        \
+    do {                                                                         \
+        if (!(condition)) {                                                      \
+            std::printf("%s:%d: expected %s\n", __FILE__, __LINE__, #condition); \
+            ++gFailures;                                                         \
+        }                                                                        \
+    } while (0)
+
+inline int finishTests(char const* suite) {
+    if (gFailures == 0) {
+        std::printf("%s: all checks passed\n", suite);
+        return 0;
+    }
+    std::printf("%s: %d check(s) failed\n", suite, gFailures);
+    return 1;
+}
+
+// Deterministic test signal: a decaying pair of tones with a loud burst, so every stage
+// (gate, three compressors, meter) moves.
+inline float testSample(int channel, long frame, double sampleRate = 48000.0) {
+    const double t     = frame / sampleRate;
+    const double level = (frame / 4096) % 3 == 0 ? 0.9 : 0.05;
+    return static_cast<float>(level * (std::sin(2.0 * M_PI * (220.0 + 110.0 * channel) * t)
+                                       + 0.3 * std::sin(2.0 * M_PI * 1870.0 * t)));
+}
+
+// Planar channel views over separate per-channel vectors.
+template <typename Sample>
+std::vector<VXAtomChannelView<Sample>> planarViews(std::vector<std::vector<float>>& channels, size_t frameOffset = 0) {
+    std::vector<VXAtomChannelView<Sample>> views;
+    for (auto& channel : channels) {
+        views.push_back({ channel.data() + frameOffset, 1 });
+    }
+    return views;
+}
+
+// Strided channel views over one interleaved buffer.
+template <typename Sample>
+std::vector<VXAtomChannelView<Sample>> interleavedViews(std::vector<float>& interleaved, UInt32 channelCount, size_t frameOffset = 0) {
+    std::vector<VXAtomChannelView<Sample>> views;
+    for (UInt32 ch = 0; ch < channelCount; ++ch) {
+        views.push_back({ interleaved.data() + frameOffset * channelCount + ch, channelCount });
+    }
+    return views;
+}
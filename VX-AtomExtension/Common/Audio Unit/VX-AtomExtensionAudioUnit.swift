@@ -18,6 +18,12 @@ public class VXAtomExtensionAudioUnit: AUAudioUnit, @unchecked Sendable
     private var _inputBusses: AUAudioUnitBusArray!
     private var _outputBusses: AUAudioUnitBusArray!
 
+    // Kernel snapshot restored from a session document before render resources existed.
+    // Applied right after kernel.initialize(), before the render block can run, so playback
+    // resumes without a warm-up transient.
+    private var pendingKernelSnapshot: Data?
+    private static let kernelSnapshotKey = "vxatomKernelSnapshot"
+
 	@objc override init(componentDescription: AudioComponentDescription, options: AudioComponentInstantiationOptions) throws {
 		let format = AVAudioFormat(standardFormatWithSampleRate: 44_100, channels: 2)!
 		try super.init(componentDescription: componentDescription, options: options)
@@ -86,6 +92,13 @@ public class VXAtomExtensionAudioUnit: AUAudioUnit, @unchecked Sendable
 
         kernel.initialize(Int32(inputChannelCount), Int32(outputChannelCount), outputBus!.format.sampleRate)
 
+        if let snapshot = pendingKernelSnapshot {
+            _ = snapshot.withUnsafeBytes { bytes in
+                kernel.readSnapshot(bytes.baseAddress, bytes.count)
+            }
+            pendingKernelSnapshot = nil
+        }
+
         processHelper?.setChannelCount(inputChannelCount, outputChannelCount)
 	}
 
@@ -103,6 +116,54 @@ public class VXAtomExtensionAudioUnit: AUAudioUnit, @unchecked Sendable
         return kernel.getGainReductionDB()
     }
 
+    // MARK: - State
+    // The kernel's DSP state (envelopes, gate, meter) travels with the document only, so a reloaded
+    // session picks up where it left off. fullState stays parameters-only: hosts also use it for
+    // presets and for copying settings between tracks, where envelopes captured from another signal
+    // would cause an audible gain jump. Parameters are restored by super through the parameter tree;
+    // the snapshot's copies of them are ignored.
+    public override var fullStateForDocument: [String : Any]? {
+        get {
+            var state = super.fullStateForDocument ?? [:]
+            // Read on the main thread while the render thread may be updating the envelopes, so the
+            // snapshot can mix values from two adjacent buffers. Accepted, as for the meter: each value
+            // is one the render loop produced, so it still validates, and the difference is one
+            // buffer's worth of smoothing.
+            var snapshot = Data(count: VXAtomExtensionDSPKernel.snapshotSize())
+            let written = snapshot.withUnsafeMutableBytes { bytes in
+                kernel.writeSnapshot(bytes.baseAddress, bytes.count)
+            }
+            if written > 0 {
+                state[Self.kernelSnapshotKey] = snapshot
+            }
+            return state
+        }
+
+        set {
+            super.fullStateForDocument = newValue
+            guard let snapshot = newValue?[Self.kernelSnapshotKey] as? Data else {
+                return
+            }
+            // An invalid snapshot (other version, sample rate or channel count, corrupt values) is
+            // ignored and the kernel keeps its current state.
+            if renderResourcesAllocated {
+                // The render thread may be running: hand the snapshot over instead of writing it here.
+                // Latest wins, so this only fails for invalid bytes, which are ignored as above.
+                _ = snapshot.withUnsafeBytes { bytes in
+                    kernel.scheduleSnapshot(bytes.baseAddress, bytes.count)
+                }
+            } else {
+                pendingKernelSnapshot = snapshot
+            }
+        }
+    }
+
+    // MARK: - Memory
+    // Bytes of render scratch memory held by the kernel, valid after allocateRenderResources.
+    func renderMemoryFootprint() -> Int {
+        return Int(kernel.renderMemoryFootprint())
+    }
+
 	public func setupParameterTree(_ parameterTree: AUParameterTree) {
 		self.parameterTree = parameterTree
 
@@ -10,6 +10,7 @@
 #import <AudioToolbox/AudioToolbox.h>
 #import <AVFoundation/AVFoundation.h>
 
+#include <algorithm>
 #include <vector>
 #include "VX-AtomExtensionDSPKernel.hpp"
 #include "VX-AtomExtensionBufferedAudioBus.hpp"
@@ -41,13 +42,8 @@ public:
         AURenderEvent const *nextEvent = events; // events is a linked list, at the beginning, the nextEvent is the first event
 
         auto callProcess = [this] (AudioBufferList* inBufferListPtr, AudioBufferList* outBufferListPtr, AUEventSampleTime now, AUAudioFrameCount frameCount, AUAudioFrameCount const frameOffset) {
-            for (int channel = 0; channel < inBufferListPtr->mNumberBuffers; ++channel) {
-                mInputBuffers[channel] = (const float*)inBufferListPtr->mBuffers[channel].mData  + frameOffset;
-            }
-            
-            for (int channel = 0; channel < outBufferListPtr->mNumberBuffers; ++channel) {
-                mOutputBuffers[channel] = (float*)outBufferListPtr->mBuffers[channel].mData + frameOffset;
-            }
+            mapChannelViews(inBufferListPtr, frameOffset, mInputBuffers);
+            mapChannelViews(outBufferListPtr, frameOffset, mOutputBuffers);
 
             mKernel.process(mInputBuffers, mOutputBuffers, now, frameCount);
         };
@@ -82,6 +78,25 @@ public:
         }
     }
 
+    /**
+     Points one channel view per channel at the buffer list, starting at frameOffset.
+     Deinterleaved lists have one channel per buffer (stride 1); interleaved lists pack
+     mNumberChannels channels into each buffer, so the view strides across the frame.
+     No samples are copied either way.
+     */
+    template <typename Sample>
+    static void mapChannelViews(AudioBufferList* bufferList, AUAudioFrameCount frameOffset, std::vector<VXAtomChannelView<Sample>>& views) {
+        size_t channel = 0;
+        for (UInt32 buffer = 0; buffer < bufferList->mNumberBuffers; ++buffer) {
+            AudioBuffer const& audioBuffer = bufferList->mBuffers[buffer];
+            const UInt32 stride = std::max<UInt32>(audioBuffer.mNumberChannels, 1);
+            Sample* base = static_cast<Sample*>(audioBuffer.mData) + static_cast<size_t>(frameOffset) * stride;
+            for (UInt32 interleavedChannel = 0; interleavedChannel < stride && channel < views.size(); ++interleavedChannel) {
+                views[channel++] = { base + interleavedChannel, stride };
+            }
+        }
+    }
+
     AURenderEvent const * performAllSimultaneousEvents(AUEventSampleTime now, AURenderEvent const *event) {
         do {
             mKernel.handleOneEvent(now, event);
@@ -145,7 +160,7 @@ public:
 	}
 private:
     VXAtomExtensionDSPKernel& mKernel;
-    std::vector<const float*> mInputBuffers;
-    std::vector<float*> mOutputBuffers;
+    std::vector<VXAtomChannelView<float const>> mInputBuffers;
+    std::vector<VXAtomChannelView<float>> mOutputBuffers;
     BufferedInputBus& mBufferedInputBus;
 };
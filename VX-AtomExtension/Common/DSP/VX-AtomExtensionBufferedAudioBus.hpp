@@ -61,8 +61,9 @@ struct BufferedAudioBus {
  */
 struct BufferedOutputBus: BufferedAudioBus {
     void prepareOutputBufferList(AudioBufferList* outBufferList, AUAudioFrameCount frameCount, bool zeroFill) {
-        UInt32 byteSize = frameCount * sizeof(float);
         for (UInt32 i = 0; i < outBufferList->mNumberBuffers; ++i) {
+            // Interleaved buffers carry mNumberChannels samples per frame.
+            UInt32 byteSize = frameCount * sizeof(float) * originalAudioBufferList->mBuffers[i].mNumberChannels;
             outBufferList->mBuffers[i].mNumberChannels = originalAudioBufferList->mBuffers[i].mNumberChannels;
             outBufferList->mBuffers[i].mDataByteSize = byteSize;
             if (outBufferList->mBuffers[i].mData == nullptr) {
@@ -123,13 +124,14 @@ struct BufferedInputBus : BufferedAudioBus {
      render cycle this function needs to be called to reset them.
      */
     void prepareInputBufferList(UInt32 frameCount) {
-        UInt32 byteSize = std::min(frameCount, maxFrames) * sizeof(float);
+        UInt32 frameBytes = std::min(frameCount, maxFrames) * sizeof(float);
         mutableAudioBufferList->mNumberBuffers = originalAudioBufferList->mNumberBuffers;
 
         for (UInt32 i = 0; i < originalAudioBufferList->mNumberBuffers; ++i) {
+            // Interleaved buffers carry mNumberChannels samples per frame.
             mutableAudioBufferList->mBuffers[i].mNumberChannels = originalAudioBufferList->mBuffers[i].mNumberChannels;
             mutableAudioBufferList->mBuffers[i].mData = originalAudioBufferList->mBuffers[i].mData;
-            mutableAudioBufferList->mBuffers[i].mDataByteSize = byteSize;
+            mutableAudioBufferList->mBuffers[i].mDataByteSize = frameBytes * originalAudioBufferList->mBuffers[i].mNumberChannels;
         }
     }
 };
@@ -11,10 +11,89 @@
 #include <AudioToolbox/AudioToolbox.h>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <span>
 #include <array>
+#include <type_traits>
 
 #include "VX-AtomExtensionParameterAddresses.h"
+#include "VX-AtomExtensionMailbox.hpp"
+#include "VX-AtomExtensionRenderArena.hpp"
+
+/*
+ VXAtomChannelView
+ Non-owning, strided view of one channel's samples inside a host buffer.
+ stride = 1 for deinterleaved buffers, stride = channels-per-buffer for interleaved ones,
+ so the kernel reads and writes interleaved audio in place without a deinterleave copy.
+*/
+template <typename Sample>
+struct VXAtomChannelView {
+    Sample* data   = nullptr;
+    UInt32  stride = 1;
+
+    Sample& operator[](UInt32 frame) const {
+        return data[static_cast<size_t>(frame) * stride];
+    }
+
+    bool isContiguous() const {
+        return stride == 1;
+    }
+};
+
+/*
+ VXAtomRenderFeatures
+ Optional kernel features that need render scratch memory. Each enabled feature adds
+ its slices to the render arena, so disabled features cost nothing.
+*/
+struct VXAtomRenderFeatures {
+    bool gainReductionTrace = false;  // per-sample, per-channel gain reduction of the last process() call
+};
+
+/*
+ VXAtomKernelSnapshot
+ Complete DSP state of one kernel: parameters, gate and envelope followers, and meter
+ ballistics. Coefficients are not stored — they are derived from the parameters and the
+ sample rate and are recomputed by applySnapshotParameters(). Plain, trivially copyable data: its binary form
+ is the struct's bytes in host byte order, led by magic / version / size so stale or foreign
+ blobs are rejected instead of misread. The layout has no padding, so every byte written is
+ a field. Bump kVersion whenever the layout changes.
+*/
+struct VXAtomKernelSnapshot {
+    static constexpr uint32_t kMagic    = 0x56584153;  // 'VXAS'
+    static constexpr uint32_t kVersion  = 1;
+    static constexpr int      kChannels = 2;
+
+    uint32_t magic        = kMagic;
+    uint32_t version      = kVersion;
+    uint32_t byteSize     = 0;
+    uint32_t channelCount = 0;
+    double   sampleRate   = 0.0;
+
+    // Parameters
+    float    compress     = 0.0f;
+    float    speed        = 0.0f;
+    float    gate         = 0.0f;
+    float    outputGainDB = 0.0f;
+    float    mix          = 1.0f;
+    uint32_t bypassed     = 0;
+
+    // Gate + envelope follower state (per channel)
+    float    gateEnvelope[kChannels] = {};
+    float    gateGain[kChannels]     = {};
+    float    envelope[kChannels]     = {};
+    float    envelope2[kChannels]    = {};
+    float    envelope3[kChannels]    = {};
+
+    // Meter ballistics
+    float    gainReductionDB = 0.0f;
+    float    meterSmoothed   = 0.0f;
+};
+
+static_assert(std::is_trivially_copyable_v<VXAtomKernelSnapshot>, "snapshots are copied as raw bytes");
+static_assert(sizeof(VXAtomKernelSnapshot) == 4 * sizeof(uint32_t) + sizeof(double) + 6 * sizeof(float)
+                                              + 5 * VXAtomKernelSnapshot::kChannels * sizeof(float) + 2 * sizeof(float),
+              "snapshot layout must have no padding bytes");
 
 /*
  VXAtomExtensionDSPKernel
@@ -48,6 +127,8 @@ public:
         mGateAttackCoeff  = computeIIRCoeff(0.002, mSampleRate);  // 2ms open
         mGateReleaseCoeff = computeIIRCoeff(0.100, mSampleRate);  // 100ms close
         updateCoefficients();
+        allocateRenderArena();
+        mScheduledSnapshots.clear();  // scheduled against the previous format
     }
 
     void deInitialize() {
@@ -58,6 +139,141 @@ public:
             mGateEnvelope[ch] = 0.0f;
             mGateGain[ch]     = 1.0f;
         }
+        mRenderArena.release();
+        mGainReductionTrace = {};
+        mTraceFrameCount    = 0;
+        mScheduledSnapshots.clear();
+    }
+
+    // MARK: - Render Features
+    // Must be set before initialize(): the render arena is sized from the enabled features.
+
+    void setRenderFeatures(VXAtomRenderFeatures features) {
+        mRenderFeatures = features;
+    }
+
+    VXAtomRenderFeatures renderFeatures() const {
+        return mRenderFeatures;
+    }
+
+    // Heap bytes held for render scratch memory, for budgeting across many instances.
+    size_t renderMemoryFootprint() const {
+        return mRenderArena.footprintBytes();
+    }
+
+    // MARK: - State Snapshot
+    // Captures or replaces the full DSP state in constant time without allocating, so a reloaded
+    // session resumes without a warm-up transient and a kernel can be forked mid-stream to render
+    // several parameter variants from the same point. Render scratch memory is not part of the state.
+
+    void saveSnapshot(VXAtomKernelSnapshot& snapshot) const {
+        // Every byte is a field (see the layout static_assert), so no indeterminate padding escapes.
+        snapshot = VXAtomKernelSnapshot {};
+        snapshot.byteSize     = sizeof(VXAtomKernelSnapshot);
+        snapshot.channelCount = static_cast<uint32_t>(mChannelCount);
+        snapshot.sampleRate   = mSampleRate;
+
+        snapshot.compress     = mCompress;
+        snapshot.speed        = mSpeed;
+        snapshot.gate         = mGate;
+        snapshot.outputGainDB = mOutputGainDB;
+        snapshot.mix          = mMix;
+        snapshot.bypassed     = mBypassed ? 1 : 0;
+
+        std::copy_n(mGateEnvelope, kMaxChannels, snapshot.gateEnvelope);
+        std::copy_n(mGateGain,     kMaxChannels, snapshot.gateGain);
+        std::copy_n(mEnvelope,     kMaxChannels, snapshot.envelope);
+        std::copy_n(mEnvelope2,    kMaxChannels, snapshot.envelope2);
+        std::copy_n(mEnvelope3,    kMaxChannels, snapshot.envelope3);
+
+        snapshot.gainReductionDB = mGainReductionDB;
+        snapshot.meterSmoothed   = mMeterSmoothed;
+    }
+
+    // Snapshots come from session files, so they are untrusted. Both restore calls return false,
+    // leaving the kernel untouched, for another layout version, sample rate or channel count,
+    // non-finite values, or state the render loop could never have produced. Neither may run concurrently with
+    // process() — use scheduleSnapshot() for that.
+
+    // Restores the DSP state only (gate, envelopes, meter). Parameters stay as they are, so the
+    // host's parameter tree remains the single source of truth for them.
+    bool restoreSnapshot(VXAtomKernelSnapshot const& snapshot) {
+        if (!isValidSnapshot(snapshot) || !matchesFormat(snapshot)) {
+            return false;
+        }
+
+        std::copy_n(snapshot.gateEnvelope, kMaxChannels, mGateEnvelope);
+        std::copy_n(snapshot.gateGain,     kMaxChannels, mGateGain);
+        std::copy_n(snapshot.envelope,     kMaxChannels, mEnvelope);
+        std::copy_n(snapshot.envelope2,    kMaxChannels, mEnvelope2);
+        std::copy_n(snapshot.envelope3,    kMaxChannels, mEnvelope3);
+
+        mGainReductionDB = snapshot.gainReductionDB;
+        mMeterSmoothed   = snapshot.meterSmoothed;
+        return true;
+    }
+
+    // Applies the snapshot's parameters, for hosts without a parameter tree (offline forking).
+    // They go through setParameter() so they are clamped, and every derived value is recomputed.
+    bool applySnapshotParameters(VXAtomKernelSnapshot const& snapshot) {
+        if (!isValidSnapshot(snapshot) || !matchesFormat(snapshot)) {
+            return false;
+        }
+
+        setParameter(VXAtomExtensionParameterAddress::compress,   snapshot.compress);
+        setParameter(VXAtomExtensionParameterAddress::speed,      snapshot.speed);
+        setParameter(VXAtomExtensionParameterAddress::gate,       snapshot.gate);
+        setParameter(VXAtomExtensionParameterAddress::outputGain, snapshot.outputGainDB);
+        setParameter(VXAtomExtensionParameterAddress::mix,        snapshot.mix);
+        setParameter(VXAtomExtensionParameterAddress::bypass,     snapshot.bypassed != 0 ? 1.0f : 0.0f);
+        mGateAttackCoeff  = computeIIRCoeff(0.002, mSampleRate);
+        mGateReleaseCoeff = computeIIRCoeff(0.100, mSampleRate);
+        updateCoefficients();
+        return true;
+    }
+
+    // Byte-level forms for Swift (fullState) and the Python bindings.
+    static size_t snapshotSize() {
+        return sizeof(VXAtomKernelSnapshot);
+    }
+
+    static bool decodeSnapshot(void const* source, size_t size, VXAtomKernelSnapshot& snapshot) {
+        if (source == nullptr || size != sizeof(VXAtomKernelSnapshot)) {
+            return false;
+        }
+        std::memcpy(&snapshot, source, sizeof(snapshot));
+        return isValidSnapshot(snapshot);
+    }
+
+    // Returns the number of bytes written, or 0 if capacity is too small.
+    size_t writeSnapshot(void* destination, size_t capacity) const {
+        if (destination == nullptr || capacity < sizeof(VXAtomKernelSnapshot)) {
+            return 0;
+        }
+        VXAtomKernelSnapshot snapshot;
+        saveSnapshot(snapshot);
+        std::memcpy(destination, &snapshot, sizeof(snapshot));
+        return sizeof(snapshot);
+    }
+
+    // Immediate DSP-state restore. Only while the render block is not running.
+    bool readSnapshot(void const* source, size_t size) {
+        VXAtomKernelSnapshot snapshot;
+        return decodeSnapshot(source, size, snapshot) && restoreSnapshot(snapshot);
+    }
+
+    // Hands a DSP-state snapshot to the render thread, which applies it at the top of the next
+    // process() call so a render never sees a half-restored state. Call from one non-render thread.
+    // Latest wins: a snapshot scheduled before the previous one was applied replaces it, and
+    // initialize() / deInitialize() drop one that was never applied. Returns false only if the
+    // bytes are invalid.
+    bool scheduleSnapshot(void const* source, size_t size) {
+        VXAtomKernelSnapshot snapshot;
+        if (!decodeSnapshot(source, size, snapshot)) {
+            return false;
+        }
+        mScheduledSnapshots.post(snapshot);
+        return true;
     }
 
     // MARK: - Bypass
@@ -122,7 +338,8 @@ public:
     // MARK: - Gain Reduction Metering
     // Written on the render thread, read on the main/UI thread.
     // A float read/write is practically safe for a meter display (worst case: one stale frame).
-    // Do NOT use std::atomic here — atomic operations are not real-time safe.
+    // Do NOT use std::atomic here — a display value gains nothing from it. The only atomic the
+    // render path touches is the lock-free snapshot mailbox (see VXAtomMailbox).
     //
     // When the host stops calling the render block (transport stopped), mRenderGeneration stops
     // advancing. Each UI poll that sees no advancement applies a release-style decay so the needle
@@ -140,15 +357,33 @@ public:
         return mGainReductionDB;
     }
 
+    // Per-sample gain reduction (positive dB, all three stages combined) for one channel,
+    // covering the most recent process() call. Empty unless gainReductionTrace is enabled.
+    std::span<float const> gainReductionTrace(int channel) {
+        std::span<float> trace = mRenderArena.data<float>(mGainReductionTrace);
+        if (trace.empty() || channel < 0 || channel >= mChannelCount) {
+            return {};
+        }
+        return trace.subspan(static_cast<size_t>(channel) * mTraceStride, mTraceFrameCount);
+    }
+
     // MARK: - Internal Process
 
-    void process(std::span<float const*> inputBuffers, std::span<float *> outputBuffers, AUEventSampleTime bufferStartTime, AUAudioFrameCount frameCount) {
+    void process(std::span<VXAtomChannelView<float const>> inputBuffers, std::span<VXAtomChannelView<float>> outputBuffers, AUEventSampleTime bufferStartTime, AUAudioFrameCount frameCount) {
         assert(inputBuffers.size() == outputBuffers.size());
         ++mRenderGeneration;  // Signals the UI thread that the render block is still being called
+        applyScheduledSnapshot();
+
+        std::span<float> trace = mRenderArena.data<float>(mGainReductionTrace);
+        mTraceFrameCount = (!trace.empty() && frameCount <= mTraceStride) ? frameCount : 0;
 
         if (mBypassed) {
             for (UInt32 ch = 0; ch < inputBuffers.size(); ++ch) {
-                std::copy_n(inputBuffers[ch], frameCount, outputBuffers[ch]);
+                passThrough(inputBuffers[ch], outputBuffers[ch], frameCount);
+            }
+            // No gain reduction while bypassed. Only the rows gainReductionTrace() exposes are cleared.
+            for (int ch = 0; ch < mChannelCount && mTraceFrameCount > 0; ++ch) {
+                std::fill_n(trace.begin() + static_cast<size_t>(ch) * mTraceStride, mTraceFrameCount, 0.0f);
             }
             mGainReductionDB = 0.0f;
             return;
@@ -197,89 +432,108 @@ public:
 
         float sumGainReductionDB = 0.0f;
 
-        for (UInt32 ch = 0; ch < inputBuffers.size(); ++ch) {
-            const int envIdx = (ch < kMaxChannels) ? ch : kMaxChannels - 1;
-
-            for (UInt32 i = 0; i < frameCount; ++i) {
-                const float inputSample = inputBuffers[ch][i];
-
-                // --- Noise Gate (pre-compression) ---
-                // Envelope follower detects signal level; gain smoothly opens/closes.
-                const float absIn = std::fabs(inputSample);
-                if (absIn > mGateEnvelope[envIdx]) {
-                    mGateEnvelope[envIdx] += mGateAttackCoeff * (absIn - mGateEnvelope[envIdx]);
-                } else {
-                    mGateEnvelope[envIdx] += mGateReleaseCoeff * (absIn - mGateEnvelope[envIdx]);
-                }
-                mGateEnvelope[envIdx] = std::max(mGateEnvelope[envIdx], 1e-10f);
-                const float targetGateGain = (mGateEnvelope[envIdx] >= gateThreshold) ? 1.0f : 0.0f;
-                if (targetGateGain > mGateGain[envIdx]) {
-                    mGateGain[envIdx] += mGateAttackCoeff * (targetGateGain - mGateGain[envIdx]);
-                } else {
-                    mGateGain[envIdx] += mGateReleaseCoeff * (targetGateGain - mGateGain[envIdx]);
-                }
-                const float gatedSample = inputSample * mGateGain[envIdx];
-
-                // --- Envelope Follower (peak detector, first-order IIR leaky integrator) ---
-                const float rectified = std::fabs(gatedSample);
-                if (rectified > mEnvelope[envIdx]) {
-                    mEnvelope[envIdx] += mAttackCoeff * (rectified - mEnvelope[envIdx]);
-                } else {
-                    mEnvelope[envIdx] += mReleaseCoeff * (rectified - mEnvelope[envIdx]);
-                }
-                // Clamp to prevent denormal floats on silence
-                mEnvelope[envIdx] = std::max(mEnvelope[envIdx], 1e-10f);
-
-                // --- Gain Computer (log domain with soft knee) ---
-                const float levelDB = 20.0f * std::log10(mEnvelope[envIdx]);
-                const float grDB    = computeGainReduction(levelDB, thresholdDB, ratio, kneeDB);
-
-                // Total gain: GR + auto makeup + output trim
-                const float totalGainDB   = grDB + autoMakeupDB + mOutputGainDB;
-                const float gainLinear    = dBToLinear(totalGainDB);
-
-                // --- Apply compression (Stage 1) ---
-                const float compressed = gatedSample * gainLinear;
-
-                // --- Stage 2: second envelope follower on post-stage-1 signal ---
-                // Stage 2's detector sees the already-compressed signal, so it reacts to stage 1's
-                // artifacts (pumping, breathing) — this is what creates the stacked-compressor character.
-                const float rectified2 = std::fabs(compressed);
-                if (rectified2 > mEnvelope2[envIdx]) {
-                    mEnvelope2[envIdx] += mAttackCoeff2 * (rectified2 - mEnvelope2[envIdx]);
-                } else {
-                    mEnvelope2[envIdx] += mReleaseCoeff2 * (rectified2 - mEnvelope2[envIdx]);
-                }
-                mEnvelope2[envIdx] = std::max(mEnvelope2[envIdx], 1e-10f);
-
-                const float levelDB2    = 20.0f * std::log10(mEnvelope2[envIdx]);
-                const float grDB2       = computeGainReduction(levelDB2, threshold2DB, ratio2, knee2);
-                const float compressed2 = compressed * dBToLinear(grDB2 + autoMakeup2);
-
-                // --- Stage 3: ceiling limiter on post-stage-2 signal ---
-                // No makeup gain — the ceiling stays down, that's the "pressed against the wall" feel.
-                const float rectified3 = std::fabs(compressed2);
-                if (rectified3 > mEnvelope3[envIdx]) {
-                    mEnvelope3[envIdx] += mAttackCoeff3 * (rectified3 - mEnvelope3[envIdx]);
-                } else {
-                    mEnvelope3[envIdx] += mReleaseCoeff3 * (rectified3 - mEnvelope3[envIdx]);
-                }
-                mEnvelope3[envIdx] = std::max(mEnvelope3[envIdx], 1e-10f);
-
-                const float levelDB3    = 20.0f * std::log10(mEnvelope3[envIdx]);
-                const float grDB3       = computeGainReduction(levelDB3, threshold3DB, ratio3, knee3);
-                const float compressed3 = compressed2 * dBToLinear(grDB3);
-
-                // --- Parallel Mix (dry = gated pre-compression signal, for transient preservation) ---
-                const float output = lerp(gatedSample, compressed3, mMix) * mOutputGainLinear;
-
-                outputBuffers[ch][i] = output;
-
-                // Accumulate gain reduction for metering (first channel only, all three stages combined)
-                if (ch == 0) {
-                    sumGainReductionDB += -(grDB + grDB2 + grDB3); // GR is negative dB; meter shows positive reduction
+        // The trace store is compiled into a separate instantiation of the channel loop, so
+        // renders without the trace (the plugin) carry no per-sample trace check.
+        auto renderChannels = [&](auto recordTrace) {
+            for (UInt32 ch = 0; ch < inputBuffers.size(); ++ch) {
+                const int envIdx = (ch < kMaxChannels) ? ch : kMaxChannels - 1;
+                float* channelTrace = (recordTrace && ch < static_cast<UInt32>(mChannelCount))
+                                    ? trace.data() + static_cast<size_t>(ch) * mTraceStride
+                                    : nullptr;
+
+                for (UInt32 i = 0; i < frameCount; ++i) {
+                    const float inputSample = inputBuffers[ch][i];
+
+                    // --- Noise Gate (pre-compression) ---
+                    // Envelope follower detects signal level; gain smoothly opens/closes.
+                    const float absIn = std::fabs(inputSample);
+                    if (absIn > mGateEnvelope[envIdx]) {
+                        mGateEnvelope[envIdx] += mGateAttackCoeff * (absIn - mGateEnvelope[envIdx]);
+                    } else {
+                        mGateEnvelope[envIdx] += mGateReleaseCoeff * (absIn - mGateEnvelope[envIdx]);
+                    }
+                    mGateEnvelope[envIdx] = std::max(mGateEnvelope[envIdx], 1e-10f);
+                    const float targetGateGain = (mGateEnvelope[envIdx] >= gateThreshold) ? 1.0f : 0.0f;
+                    if (targetGateGain > mGateGain[envIdx]) {
+                        mGateGain[envIdx] += mGateAttackCoeff * (targetGateGain - mGateGain[envIdx]);
+                    } else {
+                        mGateGain[envIdx] += mGateReleaseCoeff * (targetGateGain - mGateGain[envIdx]);
+                    }
+                    const float gatedSample = inputSample * mGateGain[envIdx];
+
+                    // --- Envelope Follower (peak detector, first-order IIR leaky integrator) ---
+                    const float rectified = std::fabs(gatedSample);
+                    if (rectified > mEnvelope[envIdx]) {
+                        mEnvelope[envIdx] += mAttackCoeff * (rectified - mEnvelope[envIdx]);
+                    } else {
+                        mEnvelope[envIdx] += mReleaseCoeff * (rectified - mEnvelope[envIdx]);
+                    }
+                    // Clamp to prevent denormal floats on silence
+                    mEnvelope[envIdx] = std::max(mEnvelope[envIdx], 1e-10f);
+
+                    // --- Gain Computer (log domain with soft knee) ---
+                    const float levelDB = 20.0f * std::log10(mEnvelope[envIdx]);
+                    const float grDB    = computeGainReduction(levelDB, thresholdDB, ratio, kneeDB);
+
+                    // Total gain: GR + auto makeup + output trim
+                    const float totalGainDB   = grDB + autoMakeupDB + mOutputGainDB;
+                    const float gainLinear    = dBToLinear(totalGainDB);
+
+                    // --- Apply compression (Stage 1) ---
+                    const float compressed = gatedSample * gainLinear;
+
+                    // --- Stage 2: second envelope follower on post-stage-1 signal ---
+                    // Stage 2's detector sees the already-compressed signal, so it reacts to stage 1's
+                    // artifacts (pumping, breathing) — this is what creates the stacked-compressor character.
+                    const float rectified2 = std::fabs(compressed);
+                    if (rectified2 > mEnvelope2[envIdx]) {
+                        mEnvelope2[envIdx] += mAttackCoeff2 * (rectified2 - mEnvelope2[envIdx]);
+                    } else {
+                        mEnvelope2[envIdx] += mReleaseCoeff2 * (rectified2 - mEnvelope2[envIdx]);
+                    }
+                    mEnvelope2[envIdx] = std::max(mEnvelope2[envIdx], 1e-10f);
+
+                    const float levelDB2    = 20.0f * std::log10(mEnvelope2[envIdx]);
+                    const float grDB2       = computeGainReduction(levelDB2, threshold2DB, ratio2, knee2);
+                    const float compressed2 = compressed * dBToLinear(grDB2 + autoMakeup2);
+
+                    // --- Stage 3: ceiling limiter on post-stage-2 signal ---
+                    // No makeup gain — the ceiling stays down, that's the "pressed against the wall" feel.
+                    const float rectified3 = std::fabs(compressed2);
+                    if (rectified3 > mEnvelope3[envIdx]) {
+                        mEnvelope3[envIdx] += mAttackCoeff3 * (rectified3 - mEnvelope3[envIdx]);
+                    } else {
+                        mEnvelope3[envIdx] += mReleaseCoeff3 * (rectified3 - mEnvelope3[envIdx]);
+                    }
+                    mEnvelope3[envIdx] = std::max(mEnvelope3[envIdx], 1e-10f);
+
+                    const float levelDB3    = 20.0f * std::log10(mEnvelope3[envIdx]);
+                    const float grDB3       = computeGainReduction(levelDB3, threshold3DB, ratio3, knee3);
+                    const float compressed3 = compressed2 * dBToLinear(grDB3);
+
+                    // --- Parallel Mix (dry = gated pre-compression signal, for transient preservation) ---
+                    const float output = lerp(gatedSample, compressed3, mMix) * mOutputGainLinear;
+
+                    outputBuffers[ch][i] = output;
+
+                    const float totalReductionDB = -(grDB + grDB2 + grDB3); // GR is negative dB; meter shows positive reduction
+                    if constexpr (decltype(recordTrace)::value) {
+                        if (channelTrace) {
+                            channelTrace[i] = totalReductionDB;
+                        }
+                    }
+
+                    // Accumulate gain reduction for metering (first channel only, all three stages combined)
+                    if (ch == 0) {
+                        sumGainReductionDB += totalReductionDB;
+                    }
                 }
             }
+        };
+        if (mTraceFrameCount > 0) {
+            renderChannels(std::true_type {});
+        } else {
+            renderChannels(std::false_type {});
         }
 
         // Update meter with VU-style ballistics.
@@ -318,6 +572,90 @@ public:
 
 private:
 
+    // MARK: - Snapshot Hand-Off
+
+    // Render thread: apply the latest snapshot queued by scheduleSnapshot(), if any. One that no
+    // longer matches the kernel's sample rate or channel count is dropped by restoreSnapshot().
+    void applyScheduledSnapshot() {
+        if (VXAtomKernelSnapshot const* snapshot = mScheduledSnapshots.take()) {
+            restoreSnapshot(*snapshot);
+        }
+    }
+
+    // MARK: - Snapshot Validation
+
+    static bool isValidSnapshot(VXAtomKernelSnapshot const& snapshot) {
+        if (snapshot.magic != VXAtomKernelSnapshot::kMagic
+            || snapshot.version != VXAtomKernelSnapshot::kVersion
+            || snapshot.byteSize != sizeof(VXAtomKernelSnapshot)
+            || snapshot.channelCount < 1 || snapshot.channelCount > VXAtomKernelSnapshot::kChannels
+            || snapshot.bypassed > 1) {
+            return false;
+        }
+
+        const float parameters[] = { snapshot.compress, snapshot.speed, snapshot.gate,
+                                     snapshot.outputGainDB, snapshot.mix };
+        for (float value : parameters) {
+            if (!std::isfinite(value)) {
+                return false;
+            }
+        }
+
+        // Envelopes and meter readings are non-negative levels; gate gain is a 0-1 fade.
+        auto isLevel = [](float value) { return std::isfinite(value) && value >= 0.0f; };
+        for (int ch = 0; ch < kMaxChannels; ++ch) {
+            if (!isLevel(snapshot.gateEnvelope[ch]) || !isLevel(snapshot.envelope[ch])
+                || !isLevel(snapshot.envelope2[ch]) || !isLevel(snapshot.envelope3[ch])
+                || !isLevel(snapshot.gateGain[ch]) || snapshot.gateGain[ch] > 1.0f) {
+                return false;
+            }
+        }
+        return isLevel(snapshot.gainReductionDB) && isLevel(snapshot.meterSmoothed);
+    }
+
+    // Envelopes are only meaningful at the sample rate and channel layout they were recorded with:
+    // a mono snapshot would leave a stereo kernel's second channel with stale state.
+    bool matchesFormat(VXAtomKernelSnapshot const& snapshot) const {
+        return snapshot.sampleRate == mSampleRate
+            && snapshot.channelCount == static_cast<uint32_t>(mChannelCount);
+    }
+
+    // MARK: - Pass-Through
+
+    static bool aliases(VXAtomChannelView<float const> input, VXAtomChannelView<float> output) {
+        return input.data == output.data && input.stride == output.stride;
+    }
+
+    // Copies one channel to another. When the render block has aliased the output onto the
+    // input (in-place processing) the samples are already where they belong, so nothing is copied.
+    static void passThrough(VXAtomChannelView<float const> input, VXAtomChannelView<float> output, AUAudioFrameCount frameCount) {
+        if (aliases(input, output)) {
+            return;
+        }
+        if (input.isContiguous() && output.isContiguous()) {
+            std::copy_n(input.data, frameCount, output.data);
+            return;
+        }
+        for (UInt32 i = 0; i < frameCount; ++i) {
+            output[i] = input[i];
+        }
+    }
+
+    // MARK: - Render Arena
+
+    // Plans every scratch slice from max frames, channel count and enabled features, then
+    // reserves one block for all of them. Runs from initialize(), never on the render thread.
+    void allocateRenderArena() {
+        const size_t traceCount = mRenderFeatures.gainReductionTrace
+                                ? static_cast<size_t>(mMaxFramesToRender) * mChannelCount
+                                : 0;
+
+        mRenderArena.reserve(VXAtomRenderArena::alignedSize<float>(traceCount));
+        mGainReductionTrace = mRenderArena.allocate<float>(traceCount);
+        mTraceStride        = mMaxFramesToRender;
+        mTraceFrameCount    = 0;
+    }
+
     // MARK: - DSP Helpers
 
     static float dBToLinear(float dB) {
@@ -379,6 +717,7 @@ private:
     // MARK: - Member Variables
 
     static constexpr int kMaxChannels = 2;
+    static_assert(kMaxChannels == VXAtomKernelSnapshot::kChannels, "snapshot must hold every channel's state");
 
     double mSampleRate    = 44100.0;
     int    mChannelCount  = 2;
@@ -419,4 +758,14 @@ private:
     uint64_t mLastUIGeneration = 0;     // last generation seen by getGainReductionDB (UI thread only)
 
     AUAudioFrameCount mMaxFramesToRender = 1024;
+
+    // Render scratch memory (sized in initialize(), only resolved on the render thread)
+    VXAtomRenderFeatures     mRenderFeatures;
+    VXAtomRenderArena        mRenderArena;
+    VXAtomRenderArena::Slice mGainReductionTrace;
+    AUAudioFrameCount        mTraceStride     = 0;  // frames per channel row, fixed when the arena is planned
+    AUAudioFrameCount        mTraceFrameCount = 0;
+
+    // Snapshot hand-off (posted by scheduleSnapshot(), taken at the top of process())
+    VXAtomMailbox<VXAtomKernelSnapshot> mScheduledSnapshots;
 };
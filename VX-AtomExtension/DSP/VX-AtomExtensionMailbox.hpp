@@ -0,0 +1,85 @@
+//
+//  VXAtomExtensionMailbox.hpp
+//  VXAtomExtension
+//
+//  Latest-wins hand-off of one value from a non-render thread to the render thread.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/*
+ VXAtomMailbox
+ Single-producer / single-consumer triple buffer.
+
+ The producer fills its private back slot and exchanges it with the shared middle slot,
+ marking it fresh. The consumer exchanges its private front slot with the middle slot
+ only when the middle is fresh. A post therefore never waits or fails, and a newer post
+ replaces an unconsumed older one — the consumer only ever sees the latest value.
+
+ Cost on the render thread: one relaxed load of a lock-free std::atomic<uint8_t> when
+ nothing is pending, plus one exchange when something is. No locks, no allocation.
+
+ Copyable so the owning kernel stays copyable; copy only while neither side is active.
+*/
+template <typename T>
+class VXAtomMailbox {
+public:
+    VXAtomMailbox() = default;
+
+    VXAtomMailbox(VXAtomMailbox const& other)
+    : mSlots(other.mSlots),
+      mBack(other.mBack),
+      mFront(other.mFront),
+      mMiddle(other.mMiddle.load(std::memory_order_relaxed)) {}
+
+    VXAtomMailbox& operator=(VXAtomMailbox const& other) {
+        mSlots = other.mSlots;
+        mBack  = other.mBack;
+        mFront = other.mFront;
+        mMiddle.store(other.mMiddle.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    // MARK: - Producer
+
+    void post(T const& value) {
+        mSlots[mBack] = value;
+        const uint8_t previous = mMiddle.exchange(mBack | kFresh, std::memory_order_acq_rel);
+        mBack = previous & kIndexMask;
+    }
+
+    // MARK: - Consumer (render thread)
+
+    // The latest value posted since the previous take(), or nullptr if there is none.
+    // The pointer stays valid until the next take().
+    T const* take() {
+        if ((mMiddle.load(std::memory_order_relaxed) & kFresh) == 0) {
+            return nullptr;
+        }
+        const uint8_t previous = mMiddle.exchange(mFront, std::memory_order_acq_rel);
+        mFront = previous & kIndexMask;
+        return &mSlots[mFront];
+    }
+
+    // MARK: - Lifecycle
+
+    // Drops an unconsumed value. Only while neither side is active.
+    void clear() {
+        mMiddle.store(mMiddle.load(std::memory_order_relaxed) & kIndexMask, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr uint8_t kIndexMask = 0x3;
+    static constexpr uint8_t kFresh     = 0x4;
+
+    std::array<T, 3>     mSlots {};
+    uint8_t              mBack   = 0;  // producer only
+    uint8_t              mFront  = 1;  // consumer only
+    std::atomic<uint8_t> mMiddle { 2 };
+
+    static_assert(std::atomic<uint8_t>::is_always_lock_free, "mailbox must be lock-free on the render thread");
+};
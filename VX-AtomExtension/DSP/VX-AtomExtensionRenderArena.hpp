@@ -0,0 +1,113 @@
+//
+//  VXAtomExtensionRenderArena.hpp
+//  VXAtomExtension
+//
+//  Single-block scratch memory owned by the DSP kernel.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/*
+ VXAtomRenderArena
+ One contiguous block of render scratch memory, carved into 64-byte-aligned slices.
+
+ Usage:
+   1. Off the render thread (allocateRenderResources), call reserve() with the summed
+      alignedSize() of every slice, then allocate() each slice once and keep its handle.
+   2. On the render thread, resolve handles with data() — no allocation, no locking.
+   3. release() in deallocateRenderResources.
+
+ Slices never overlap. Handles are offsets rather than pointers, so a copied kernel
+ resolves them against its own storage instead of the original's.
+*/
+class VXAtomRenderArena {
+public:
+    static constexpr size_t kAlignment = 64;  // one cache line; also enough for any SIMD load
+
+    // Handle to a slice of the arena. An empty slice (count == 0) resolves to an empty span.
+    struct Slice {
+        size_t offset = 0;
+        size_t count  = 0;
+    };
+
+    // Bytes a slice of `count` elements of T occupies, rounded up to the arena alignment.
+    template <typename T>
+    static constexpr size_t alignedSize(size_t count) {
+        return roundUp(count * sizeof(T));
+    }
+
+    // MARK: - Lifecycle (not real-time safe)
+
+    // Allocates storage for `bytes` of slices and rewinds the arena. Contents are zeroed.
+    // A smaller plan than the current one gives the surplus back, so the footprint always
+    // reflects the current plan.
+    void reserve(size_t bytes) {
+        const size_t storageBytes = roundUp(bytes) + kAlignment - 1;
+        if (bytes == 0 || storageBytes < mStorage.capacity()) {
+            release();
+        }
+        if (bytes == 0) {
+            return;
+        }
+        mStorage.assign(storageBytes, std::byte{0});
+        mCapacity = roundUp(bytes);
+        mUsed     = 0;
+    }
+
+    // Frees the storage. Outstanding handles must not be resolved afterwards.
+    void release() {
+        std::vector<std::byte>().swap(mStorage);
+        mCapacity = 0;
+        mUsed     = 0;
+    }
+
+    // Carves the next slice of `count` elements. Returns an empty slice if the arena is exhausted,
+    // which means reserve() was sized from a different plan than the one being allocated.
+    template <typename T>
+    Slice allocate(size_t count) {
+        const size_t bytes = alignedSize<T>(count);
+        if (count == 0 || mUsed + bytes > mCapacity) {
+            return {};
+        }
+        const Slice slice { mUsed, count };
+        mUsed += bytes;
+        return slice;
+    }
+
+    // MARK: - Render Thread
+
+    template <typename T>
+    std::span<T> data(Slice slice) {
+        if (slice.count == 0) {
+            return {};
+        }
+        return { reinterpret_cast<T*>(alignedBase() + slice.offset), slice.count };
+    }
+
+    // MARK: - Footprint
+
+    size_t capacityBytes() const  { return mCapacity; }
+    size_t usedBytes() const      { return mUsed; }
+    // Heap bytes actually held, including the alignment slack.
+    size_t footprintBytes() const { return mStorage.capacity(); }
+
+private:
+    static constexpr size_t roundUp(size_t bytes) {
+        return (bytes + kAlignment - 1) & ~(kAlignment - 1);
+    }
+
+    // Recomputed on every call because a copied vector may land on a different alignment.
+    std::byte* alignedBase() {
+        const auto address = reinterpret_cast<uintptr_t>(mStorage.data());
+        return mStorage.data() + ((kAlignment - (address & (kAlignment - 1))) & (kAlignment - 1));
+    }
+
+    std::vector<std::byte> mStorage;
+    size_t mCapacity = 0;
+    size_t mUsed     = 0;
+};